@@ -0,0 +1,239 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../list_concurrent.h"
+#include "../src/log_info/log_errors.h"
+
+//Contention of Concurrent_list against the plain List under one global mutex, 1 to 64 threads.
+//Usage: bench_concurrent [cnt_ops = 200000] [read_pct = 90] [check_level = 0]
+
+static const int  Max_bench_threads = 64;
+static const long Start_list_size   = 1000;
+static const int  Walk_read_period  = 9;        //<- Every Walk_read_period-th read walks the whole list
+
+struct Bench_thread_arg
+{
+    Concurrent_list *clist        = nullptr;
+    std::mutex      *global_mutex = nullptr;    //<- nullptr means the Concurrent_list functions
+
+    long cnt_ops  = 0;
+    int  read_pct = 0;
+
+    unsigned seed = 0;
+
+    long cnt_inserted = 0;
+    int  is_failed    = 0;
+};
+
+static int  Bench_contention (const int cnt_threads, const long cnt_ops, const int read_pct,
+                              const int is_global_mutex, double *time_us, double *mean_batch);
+
+static void Bench_thread     (Bench_thread_arg *arg);
+
+static int  Bench_read_op    (Bench_thread_arg *arg, const unsigned op);
+
+static int  Bench_insert_op  (Bench_thread_arg *arg, const unsigned op);
+
+static int  Sum_read         (const List *list, void *arg);
+
+//======================================================================================
+
+int main (int argc, char **argv)
+{
+    long cnt_ops     = (argc > 1) ? atol (argv[1]) : 200000;
+    int  read_pct    = (argc > 2) ? atoi (argv[2]) : 90;
+    int  check_level = (argc > 3) ? atoi (argv[3]) : LIST_CHECK_OFF;
+
+    if (cnt_ops <= 0 || read_pct < 0 || read_pct > 100 || List_set_check_level (check_level))
+    {
+        Log_report ("Incorrect arguments: cnt_ops = %ld, read_pct = %d, check_level = %d\n",
+                     cnt_ops, read_pct, check_level);
+        return -1;
+    }
+
+    printf ("%8s %16s %12s %16s %8s\n", "threads", "concurrent, us", "mean batch", "global mutex, us", "ratio");
+
+    for (int cnt_threads = 1; cnt_threads <= Max_bench_threads; cnt_threads *= 2)
+    {
+        double concurrent_us = 0;
+        double mutex_us      = 0;
+        double mean_batch    = 0;
+
+        if (Bench_contention (cnt_threads, cnt_ops, read_pct, 0, &concurrent_us, &mean_batch) ||
+            Bench_contention (cnt_threads, cnt_ops, read_pct, 1, &mutex_us,      nullptr))
+            return -1;
+
+        printf ("%8d %16.0f %12.2f %16.0f %8.2f\n", cnt_threads, concurrent_us, mean_batch, mutex_us,
+                (concurrent_us > 0) ? mutex_us / concurrent_us : 0);
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Bench_contention (const int cnt_threads, const long cnt_ops, const int read_pct,
+                             const int is_global_mutex, double *time_us, double *mean_batch)
+{
+    assert (time_us != nullptr && "time_us is nullptr");
+
+    Concurrent_list clist = {};
+    std::mutex      global_mutex;
+
+    if (Concurrent_list_ctor (&clist, Start_list_size))
+        return -1;
+
+    for (long it = 0; it < Start_list_size; it++)
+        Concurrent_list_insert_back (&clist, 1);
+
+    std::vector<Bench_thread_arg> args ((size_t) cnt_threads);
+    std::vector<std::thread>      threads;
+
+    for (int it = 0; it < cnt_threads; it++)
+    {
+        args[(size_t) it].clist        = &clist;
+        args[(size_t) it].global_mutex = is_global_mutex ? &global_mutex : nullptr;
+        args[(size_t) it].cnt_ops      = cnt_ops / cnt_threads;
+        args[(size_t) it].read_pct     = read_pct;
+        args[(size_t) it].seed         = (unsigned) it * 77u + 1u;
+    }
+
+    auto start = std::chrono::steady_clock::now ();
+
+    for (int it = 0; it < cnt_threads; it++)
+        threads.emplace_back (Bench_thread, &args[(size_t) it]);
+
+    for (size_t it = 0; it < threads.size (); it++)
+        threads[it].join ();
+
+    auto finish = std::chrono::steady_clock::now ();
+
+    *time_us = std::chrono::duration<double, std::micro> (finish - start).count ();
+
+    if (mean_batch != nullptr)
+        *mean_batch = (clist.cnt_batches > 0) ? (double) clist.cnt_changes / (double) clist.cnt_batches : 0;
+
+    //Every insert adds 1, so the sum of the values is the size of the list
+    long cnt_inserted = 0;
+    int  is_failed    = 0;
+
+    for (size_t it = 0; it < args.size (); it++)
+    {
+        cnt_inserted += args[it].cnt_inserted;
+        is_failed    |= args[it].is_failed;
+    }
+
+    long sum_vals = 0;
+    Concurrent_list_read (&clist, Sum_read, &sum_vals);
+
+    if (is_failed || Concurrent_list_size (&clist) != Start_list_size + cnt_inserted ||
+                     sum_vals                      != Start_list_size + cnt_inserted)
+    {
+        Log_report ("Incorrect list after %d threads, is_global_mutex = %d\n", cnt_threads, is_global_mutex);
+        Concurrent_list_dtor (&clist);
+        return -1;
+    }
+
+    if (Concurrent_list_dtor (&clist))
+        return -1;
+
+    return 0;
+}
+
+//======================================================================================
+
+static void Bench_thread (Bench_thread_arg *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    for (long it = 0; it < arg->cnt_ops && !arg->is_failed; it++)
+    {
+        arg->seed = arg->seed * 1103515245u + 12345u;
+
+        unsigned op = (arg->seed >> 16) % 100;
+
+        if ((int) op < arg->read_pct)
+            arg->is_failed = Bench_read_op (arg, op);
+        else
+            arg->is_failed = Bench_insert_op (arg, op);
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static int Bench_read_op (Bench_thread_arg *arg, const unsigned op)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    long sum_vals = 0;
+
+    if (arg->global_mutex == nullptr)
+    {
+        if (op % Walk_read_period == 0)
+            return Concurrent_list_read (arg->clist, Sum_read, &sum_vals);
+
+        return Concurrent_list_count (arg->clist, 1) < 0;
+    }
+
+    std::lock_guard<std::mutex> lock (*arg->global_mutex);
+
+    if (op % Walk_read_period == 0)
+        return Sum_read (&arg->clist->list, &sum_vals);
+
+    return List_count (&arg->clist->list, 1) < 0;
+}
+
+//======================================================================================
+
+static int Bench_insert_op (Bench_thread_arg *arg, const unsigned op)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    link_t ret = 0;
+
+    if (arg->global_mutex == nullptr)
+    {
+        ret = (op % 2) ? Concurrent_list_insert_back  (arg->clist, 1) :
+                         Concurrent_list_insert_front (arg->clist, 1);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock (*arg->global_mutex);
+
+        ret = (op % 2) ? List_insert_back  (&arg->clist->list, 1) :
+                         List_insert_front (&arg->clist->list, 1);
+    }
+
+    if (ret <= 0) return 1;
+
+    arg->cnt_inserted++;
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Sum_read (const List *list, void *arg)
+{
+    assert (list != nullptr && "list is nullptr");
+    assert (arg  != nullptr && "arg is nullptr");
+
+    long sum_vals = 0;
+
+    for (link_t ind = list->head_ptr; ind != Dummy_element; ind = Node_next (list, ind))
+        sum_vals += (long) Node_val (list, ind);
+
+    *(long*) arg = sum_vals;
+
+    return 0;
+}
+
+//======================================================================================
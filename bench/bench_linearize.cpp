@@ -0,0 +1,132 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+#include "../list.h"
+#include "../list_parallel.h"
+#include "../src/log_info/log_errors.h"
+
+//Serial and parallel List_linearize of a fragmented list of 10^6 to max_nodes nodes.
+//Usage: bench_linearize [max_nodes = 100000000] [cnt_threads = 0, all hardware threads]
+
+static const long Min_bench_nodes = 1000000;
+
+static int Bench_build_list (List *list, const long cnt_nodes);
+
+static int Bench_linearize  (const long cnt_nodes, const int cnt_threads, double *time_ms);
+
+//======================================================================================
+
+int main (int argc, char **argv)
+{
+    long max_nodes   = (argc > 1) ? atol (argv[1]) : 100000000;
+    int  cnt_threads = (argc > 2) ? atoi (argv[2]) : 0;
+
+    List_set_check_level (LIST_CHECK_OFF);
+
+    if (Parallel_set_threads (cnt_threads))
+    {
+        Log_report ("Incorrect number of threads = %d\n", cnt_threads);
+        return -1;
+    }
+
+    cnt_threads = Parallel_get_threads ();
+
+    printf ("%12s %12s %12s %12s %8s\n", "nodes", "serial, ms", "threads", "parallel, ms", "speedup");
+
+    for (long cnt_nodes = Min_bench_nodes; cnt_nodes <= max_nodes; cnt_nodes *= 10)
+    {
+        double serial_ms   = 0;
+        double parallel_ms = 0;
+
+        if (Bench_linearize (cnt_nodes, 1,           &serial_ms) ||
+            Bench_linearize (cnt_nodes, cnt_threads, &parallel_ms))
+            return -1;
+
+        printf ("%12ld %12.1f %12d %12.1f %8.2f\n", cnt_nodes, serial_ms, cnt_threads, parallel_ms,
+                (parallel_ms > 0) ? serial_ms / parallel_ms : 0);
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Bench_linearize (const long cnt_nodes, const int cnt_threads, double *time_ms)
+{
+    assert (time_ms != nullptr && "time_ms is nullptr");
+
+    Parallel_set_threads (cnt_threads);
+
+    List list = {};
+
+    if (Bench_build_list (&list, cnt_nodes))
+        return -1;
+
+    auto start = std::chrono::steady_clock::now ();
+
+    int linearize_err = List_linearize (&list);
+
+    auto finish = std::chrono::steady_clock::now ();
+
+    *time_ms = std::chrono::duration<double, std::milli> (finish - start).count ();
+
+    if (linearize_err || list.is_linearized != 1 || list.tail_ptr != (link_t) list.size_data)
+    {
+        Log_report ("Linearize error, cnt_nodes = %ld, cnt_threads = %d\n", cnt_nodes, cnt_threads);
+        List_dtor (&list);
+        return -1;
+    }
+
+    if (List_dtor (&list))
+        return -1;
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Bench_build_list (List *list, const long cnt_nodes)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (List_ctor (list, cnt_nodes))
+    {
+        Log_report ("List ctor error, cnt_nodes = %ld\n", cnt_nodes);
+        return -1;
+    }
+
+    List_set_linearize_budget (list, 0);
+
+    //Inserts at both ends and erases near the head scatter the logical order over the array
+    unsigned seed = 7;
+
+    while (list->size_data < cnt_nodes)
+    {
+        seed = seed * 1103515245u + 12345u;
+
+        unsigned op = (seed >> 16) % 10;
+
+        link_t ret = 0;
+
+        if (op < 5)
+            ret = List_insert_back  (list, (elem_t) list->size_data);
+        else if (op < 8)
+            ret = List_insert_front (list, (elem_t) list->size_data);
+        else if (list->size_data > 2)
+            ret = (link_t) List_erase (list, Node_next (list, list->head_ptr));
+
+        if (ret < 0)
+        {
+            Log_report ("List change error, size_data = %ld\n", list->size_data);
+            List_dtor (list);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+//======================================================================================
@@ -2,18 +2,100 @@
 #define _LIST_CONFIG_H_
 
 #include <stdint.h>
+#include <inttypes.h>
 
 typedef int elem_t;
 
 
 const elem_t Poison_val = 404;  //<- In free nodes is written
 
-const int Poison_ptr  = -126;   //<- Written to a pointer when the list is cleared
+#ifndef LIST_LINK_BITS
+#define LIST_LINK_BITS 32       //<- Width of next and prev of the nodes: 16, 32 or 64. The list holds less than 2^(LIST_LINK_BITS - 1) nodes
+#endif
+
+//link_t is signed: free nodes keep negative numbers in prev, LINK_T_SPEC is the specifier to print links
+#if   LIST_LINK_BITS == 16
+
+    typedef int16_t link_t;
+    const link_t Link_max = INT16_MAX;
+    #define LINK_T_SPEC PRId16
+
+#elif LIST_LINK_BITS == 32
+
+    typedef int32_t link_t;
+    const link_t Link_max = INT32_MAX;
+    #define LINK_T_SPEC PRId32
+
+#elif LIST_LINK_BITS == 64
+
+    typedef int64_t link_t;
+    const link_t Link_max = INT64_MAX;
+    #define LINK_T_SPEC PRId64
+
+#else
+
+    #error "LIST_LINK_BITS must be 16, 32 or 64"
+
+#endif
+
+const link_t Poison_ptr = -Link_max - 1;    //<- Written to a pointer when the list is cleared. Free nodes never keep it in prev
 
 #define USE_LOG                 //<- connect when we use logs
 
 
-#define LIST_DATA_CHECK      //<- Checking non-free list nodes for correct transitions and values
+#ifndef LIST_CHECK_LEVEL
+#define LIST_CHECK_LEVEL 3      //<- Maximum verification level: 0 - no checks, 1 - O(1) header checks, 
+#endif                          //   2 - checks of the nodes touched by the last operation, 3 - full walks over nodes
+
+#ifndef LIST_AUDIT_PERIOD
+#define LIST_AUDIT_PERIOD 1024  //<- With level 2 every LIST_AUDIT_PERIOD operation runs the full walk, 0 - never
+#endif
+
+#ifndef LIST_GROWTH_FACTOR
+#define LIST_GROWTH_FACTOR 2.0  //<- Capacity of a full list is multiplied by it
+#endif
+
+#ifndef LIST_SHRINK_RATIO
+#define LIST_SHRINK_RATIO 4.0   //<- The list is shrunk when capacity / LIST_SHRINK_RATIO nodes are used, 0 - never
+#endif
+
+#ifndef LIST_MIN_CAPACITY
+#define LIST_MIN_CAPACITY 1     //<- The list is not shrunk below it
+#endif
+
+#ifndef LIST_MMAP_THRESHOLD
+#define LIST_MMAP_THRESHOLD (1 << 21)   //<- Bytes of data from which it is mapped and grown by mremap on Linux
+#endif
+
+#ifndef LIST_LINEARIZE_BUDGET
+#define LIST_LINEARIZE_BUDGET 0 //<- Nodes moved to their places by each insert and erase, 0 - only by List_linearize_step
+#endif
+
+#ifndef LIST_ALLOC_WINDOW
+#define LIST_ALLOC_WINDOW 4     //<- Words of the occupancy bitmap searched on each side of the neighbour for a free node
+#endif
+
+#ifndef LIST_PARALLEL_MIN_NODES
+#define LIST_PARALLEL_MIN_NODES (1 << 16)   //<- Smaller lists are processed by List_parallel_* in the calling thread
+#endif
+
+#ifndef LIST_PARALLEL_CHUNK
+#define LIST_PARALLEL_CHUNK (1 << 14)       //<- Nodes in a part of the deterministic reduction, the result depends only on it
+#endif
+
+#ifndef LIST_RANK_RULER_GAP
+#define LIST_RANK_RULER_GAP 256             //<- Nodes between rulers of the parallel linearization, a multiple of 64
+#endif
+
+#ifndef LIST_SORT_RADIX_MIN_NODES
+#define LIST_SORT_RADIX_MIN_NODES 1024      //<- Smaller lists are sorted by List_sort with the merge sort only
+#endif
+
+#ifndef LIST_CHUNK_BYTES
+#define LIST_CHUNK_BYTES 64     //<- Size of a chunk of Unrolled_list, a cache line
+#endif
+
+//#define LIST_SOA               //<- Values and links of the nodes are kept in three separate arrays
 
 #define GRAPH_DUMP
 
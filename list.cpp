@@ -3,28 +3,176 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
 
 #include "list.h"
+#include "list_index.h"
+#include "list_handle.h"
+#include "list_simd.h"
+#include "list_parallel.h"
 
 #include "src/log_info/log_errors.h"
 #include "src/Generals_func/generals.h"
 
 
-static int Init_list_data   (List *list);
+static int Init_list_data   (List *list, const link_t first_node, const link_t last_node);
+
+static long List_resize     (const List *list);
+
+static long List_next_capacity (const List *list, const long capacity);
+
+static int List_reserve_nodes (List *list, const long cnt_nodes);
+
+static int List_recalloc    (List *list, const long new_capacity);
+
+static size_t List_array_bytes   (const long capacity, const size_t elem_size);
+
+static void List_get_arrays      (const List *list, void *arrays[]);
+
+static void List_set_arrays      (List *list, void *arrays[]);
+
+static int List_data_is_nullptr  (const List *list);
+
+static int List_data_alloc       (List *list, const long capacity);
+
+static int List_data_realloc     (List *list, const long new_capacity);
+
+static void List_data_free       (List *list);
+
+#ifdef __linux__
+    static void* List_array_map  (const long capacity, const size_t elem_size);
+
+    static int List_arrays_map   (void *arrays[], const long capacity);
+#endif
+
+static link_t List_link_run    (List *list, const link_t prev_ptr, const elem_t *vals, 
+                             const List *src_list, const link_t src_ptr, const long cnt_vals);
+
+static long List_count_range  (const List *list, const link_t first_ind, const link_t last_ind);
+
+static void List_unlink_range (List *list, const link_t first_ind, const link_t last_ind, const long cnt_nodes);
+
+static int List_relink_range  (List *list, const link_t ind, const link_t first_ind, const link_t last_ind);
+
+static int Elem_cmp_default   (const elem_t first, const elem_t second);
+
+static link_t List_merge_runs (List *list, link_t first_run, link_t second_run, Elem_cmp_t cmp);
+
+static void List_merge_sort   (List *list, Elem_cmp_t cmp);
+
+static int List_radix_sort    (List *list);
+
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value, int>::type
+Radix_sort_vals (T *vals, T *buf, const long cnt_vals);
+
+template <typename T>
+static typename std::enable_if<!std::is_integral<T>::value, int>::type
+Radix_sort_vals (T *vals, T *buf, const long cnt_vals);
+
+
+static void List_index_on_insert  (List *list, const link_t prev_ptr, const link_t ind);
+
+static void List_index_on_erase   (List *list, const link_t ind);
+
+static void List_index_invalidate (List *list);
+
+static void List_contiguous_run (const List *list, link_t *first_ptr, long *cnt_nodes);
+
+static inline void List_prefetch_node (const List *list, const link_t ind);
+
+static void List_for_each_task (const long task_ind, void *arg);
+
+static void List_reduce_task   (const long task_ind, void *arg);
 
-static int List_resize      (List *list);
+static elem_t List_reduce_serial (const List *list, Elem_combine_t combine, const elem_t init, const int is_deterministic);
 
-static int List_recalloc    (List *list, int ver_resize);
+static void List_handles_on_insert (List *list, const link_t ind);
 
-static void Init_node (Node *list_elem, elem_t val, int next, int prev);
+static void List_handles_on_erase  (List *list, const link_t ind);
 
-static int Check_correct_ind (const List *list, const int ind);
+static link_t List_pop_free_node (List *list, const link_t prev_ptr, const link_t next_ptr);
+
+static void List_push_free_node   (List *list, const link_t ind);
+
+static void List_unlink_free_node (List *list, const link_t ind);
+
+static int Is_free_node (const List *list, const link_t ind);
+
+
+static size_t Occupancy_words (const long capacity);
+
+static int List_occupancy_realloc (List *list, const long new_capacity);
+
+static void Occupancy_set   (List *list, const link_t ind);
+
+static void Occupancy_reset (List *list, const link_t ind);
+
+static int Is_occupied (const List *list, const link_t ind);
+
+static long Occupancy_count (const List *list, const link_t first_ind, const link_t last_ind);
+
+static link_t List_find_free_after  (const List *list, const link_t ind);
+
+static link_t List_find_free_before (const List *list, const link_t ind);
+
+
+static int List_linearize_run (List *list, const long budget, link_t *tracked_ind);
+
+static int List_compact       (List *list);
+
+static int List_compact_parallel (List *list);
+
+static void List_rank_rulers_task  (const long task_ind, void *arg);
+
+static void List_rank_walk_task    (const long task_ind, void *arg);
+
+static void List_rank_offset_task  (const long task_ind, void *arg);
+
+static void List_rank_gather_task  (const long task_ind, void *arg);
+
+static void List_rank_scatter_task (const long task_ind, void *arg);
+
+static void List_move_node    (List *list, const link_t to_ind, const link_t from_ind);
+
+static void List_prefix_cut   (List *list, const link_t ind);
+
+static void Init_node (List *list, const link_t ind, elem_t val, link_t next, link_t prev);
+
+static int Check_correct_ind (const List *list, const link_t ind);
 
 static int List_data_not_free_verifier  (const List *list);
 
 static int List_data_free_verifier      (const List *list);
 
-static uint64_t Check_list (const List *list);
+static int List_dirty_verifier          (const List *list);
+
+static int List_node_verifier           (const List *list, const link_t ind);
+
+static uint64_t List_verify      (const List *list, const int check_level);
+
+#if LIST_CHECK_LEVEL > 0
+
+static uint64_t List_verify_exit (List *list, const int check_level);
+
+static int List_is_audit_due     (const List *list);
+
+#endif
+
+
+static void List_dirty_reset    (List *list);
+
+static void List_dirty_mark     (List *list, const link_t ind);
+
+static void List_dirty_mark_all (List *list);
 
 
 static int List_draw_logical_graph  (const List *list);
@@ -41,6 +189,43 @@ static void Print_error_value (uint64_t err, FILE *fpout);
         Err_report ();                                      \
                                                             \
     }while (0)
+
+
+static std::atomic<int> Cur_check_level (LIST_CHECK_LEVEL);    //<- Current verification level, see List_set_check_level
+
+static std::mutex Dump_mutex;   //<- Dumps of different threads share the log file, graph_img/graph.txt and the graph counters
+
+#ifdef LIST_SOA
+
+    const int Cnt_node_arrays = 3;
+    static const size_t Node_array_elem_sizes[Cnt_node_arrays] = {sizeof (elem_t), sizeof (link_t), sizeof (link_t)};
+
+    const size_t Node_val_stride = sizeof (elem_t);     //<- Bytes between values of neighbouring nodes
+
+#else
+
+    const int Cnt_node_arrays = 1;
+    static const size_t Node_array_elem_sizes[Cnt_node_arrays] = {sizeof (Node)};
+
+    const size_t Node_val_stride = sizeof (Node);
+
+#endif
+
+#if LIST_CHECK_LEVEL > 0
+
+    #define Check_list(list)                                \
+            List_verify (list, Cur_check_level)
+
+    #define Check_list_exit(list)                           \
+            List_verify_exit (list, Cur_check_level)
+
+#else
+
+    #define Check_list(list) 0
+
+    #define Check_list_exit(list) 0
+
+#endif
                                     
 //======================================================================================
 
@@ -48,9 +233,9 @@ int List_ctor (List *list, long capacity)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (capacity <= 0)
+    if (capacity <= 0 || capacity > Max_list_capacity)
     {
-        Log_report ("Incorrectly entered capacity values: %d\n", capacity);
+        Log_report ("Incorrectly entered capacity values: %ld\n", capacity);
         Err_report ();
 
         return LIST_CTOR_ERR;
@@ -58,17 +243,30 @@ int List_ctor (List *list, long capacity)
 
     list->tail_ptr = Dummy_element;
     list->head_ptr = Dummy_element;
-    list->free_ptr = 1;
+    list->free_ptr = Identifier_free_node;
+    list->bump_ptr = 1;                     //<- Nodes are not initialized until they are used
 
     list->is_linearized = 1;
+    list->linear_prefix = 0;
+
+    list->linearize_budget = LIST_LINEARIZE_BUDGET;
 
     list->size_data      = 0;
     list->capacity       = capacity;
-    list->cnt_free_nodes = 0;
+    list->cnt_free_nodes = capacity;
+
+    list->cnt_operations = 0;
+    list->audit_period   = LIST_AUDIT_PERIOD;
+
+    list->index   = nullptr;
+    list->handles = nullptr;
+
+    list->resize_policy     = {};
+    list->reserved_capacity = 0;
 
-    list->data = (Node*) calloc (capacity + 1, sizeof (Node));
+    List_dirty_mark_all (list);
 
-    if (Check_nullptr (list->data))
+    if (List_data_alloc (list, capacity))
     {
         Log_report ("Memory allocation error\n");
         Err_report ();
@@ -76,18 +274,27 @@ int List_ctor (List *list, long capacity)
         return LIST_CTOR_ERR;
     }
 
-    Init_node (&list->data[0], 
-               Poison_val, Dummy_element, Dummy_element);
-
+    list->occupancy = (uint64_t*) calloc (Occupancy_words (capacity), sizeof (uint64_t));
 
-    if (Init_list_data (list))
+    if (Check_nullptr (list->occupancy))
     {
-        Log_report ("Node initialization error\n");
+        List_data_free (list);
+
+        Log_report ("Memory allocation error\n");
         Err_report ();
 
         return LIST_CTOR_ERR;
     }
 
+    Init_node (list, Dummy_element, 
+               Poison_val, Dummy_element, Dummy_element);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_ctor\n");
+        return LIST_CTOR_ERR;
+    }
+
     return 0;
 }
 
@@ -103,567 +310,3224 @@ int List_dtor (List *list)
         return LIST_DTOR_ERR;
     }
 
-    if (Check_nullptr (list->data))
+    if (List_data_is_nullptr (list))
         Log_report ("Data is nullptr in dtor\n");
     else    
-        free (list->data);
+        List_data_free (list);
+
+    free (list->occupancy);
+    list->occupancy = nullptr;
+
+    List_disable_index   (list);
+    List_disable_handles (list);
 
     list->tail_ptr = Poison_ptr;
     list->head_ptr = Poison_ptr;
     list->free_ptr = Poison_ptr;
+    list->bump_ptr = Poison_ptr;
 
     list->size_data         = -1;
     list->capacity          = -1;
     list->cnt_free_nodes    = -1;
     
     list->is_linearized = -1;
+    list->linear_prefix = -1;
 
     return 0;
 }
 
 //======================================================================================
 
-static int Init_list_data (List *list)
+static int Init_list_data (List *list, const link_t first_node, const link_t last_node)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_list (list))
+    if (first_node > last_node) return 0;
+
+    if (first_node <= Dummy_element || last_node > list->capacity)
     {
-        REPORT ("ENTRY\nFROM: Init_list_data\n");
+        Log_report ("Incorrect range of free nodes: [%" LINK_T_SPEC ", %" LINK_T_SPEC "]\n", first_node, last_node);
         return DATA_INIT_ERR;
     }
 
-    int Last_used_node = MAX (list->tail_ptr, list->head_ptr);
+    for (link_t ip = first_node; ip < last_node; ip++) 
+    {
+        Init_node (list, ip, Poison_val, ip + 1, Identifier_free_node - (ip - 1));
+        Occupancy_reset (list, ip);
+    }
 
+    Occupancy_reset (list, last_node);
 
-    for (int ip = Last_used_node + 1; ip < list->capacity; ip++) 
-        Init_node (list->data + ip, Poison_val, ip + 1, Identifier_free_node);
+    Init_node (list, last_node, Poison_val, list->free_ptr, Identifier_free_node - (last_node - 1));
 
-    Init_node (list->data + list->capacity, Poison_val, Identifier_free_node, Identifier_free_node);
+    Node_prev (list, first_node) = Identifier_free_node;
 
+    if (list->free_ptr != Identifier_free_node)
+        Node_prev (list, list->free_ptr) = Identifier_free_node - last_node;
 
-    list->cnt_free_nodes = list->capacity - list->size_data;
+    list->free_ptr = first_node;
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: Init_list_data\n");
-        return DATA_INIT_ERR;
-    }
+    list->cnt_free_nodes += last_node - first_node + 1;
 
     return 0;
 }
 
 //======================================================================================
 
-static void Init_node (Node *list_elem, elem_t val, int next, int prev)
+static void Init_node (List *list, const link_t ind, elem_t val, link_t next, link_t prev)
 {
-    assert (list_elem != nullptr && "list_elem ptr is nullptr");
+    assert (list != nullptr && "list ptr is nullptr");
 
-    list_elem->val  = val;
-    list_elem->next = next;
-    list_elem->prev = prev; 
+    Node_val  (list, ind) = val;
+    Node_next (list, ind) = next;
+    Node_prev (list, ind) = prev; 
 
     return;
 }
 
 //======================================================================================
 
-int List_insert_befor_ind (List *list, const int ind, const elem_t val) 
+static link_t List_link_run (List *list, const link_t prev_ptr, const elem_t *vals, 
+                          const List *src_list, const link_t src_ptr, const long cnt_vals)
 {
     assert (list != nullptr && "list is nullptr");
+    assert ((vals != nullptr || src_list != nullptr) && "no source of values");
+    assert (src_list != list && "the run can not be copied from the same list");
 
-    if (Check_list (list))
+    if (cnt_vals >= list->cnt_free_nodes)     //<- One free node is always kept
     {
-        REPORT ("ENTRY\nFROM: List_insert_befor_ind,"
-                        " ind = %d, val = %d\n", ind, val);
+        Log_report ("No free space in list, cnt_vals = %ld\n", cnt_vals);
         return LIST_INSERT_ERR;
     }
-    
-    int ver_resize = List_resize (list);
-    if (List_recalloc (list, ver_resize))
-    {
-        Log_report ("Recalloc error\n");
-        Err_report ();
-        return LIST_INSERT_ERR;
-    } 
 
-    if (!Check_correct_ind (list, ind) && ind != Dummy_element)
-    {
-        Log_report ("Incorrect ind = %d\n", ind);
-        return LIST_INSERT_ERR;
-    }
+    link_t next_ptr  = Node_next (list, prev_ptr);
 
-    
-    if (list->free_ptr == Dummy_element)
-    {
-        Log_report ("No free space in list\n");
-        return LIST_INSERT_ERR;
-    }
+    link_t first_ptr = Dummy_element;
+    link_t cur_ptr   = prev_ptr;
+
+    int is_contiguous = 1;
+
+    link_t src_cur_ptr = src_ptr;      //<- Without vals the values are copied along the chain of src_list
 
-    if (list->data[ind].prev == Identifier_free_node)
+    for (long it = 0; it < cnt_vals; it++)
     {
-        Log_report ("There is nothing at this pointer: %d.\n" 
-                    "You can only add an element before initialized elements\n", ind);
-        return LIST_INSERT_ERR;
-    }
+        link_t cur_free_ptr = List_pop_free_node (list, cur_ptr, next_ptr);
 
-        
-    if (list->head_ptr != ind && list->tail_ptr != ind)
-        list->is_linearized = 0;
+        if (it != 0 && cur_free_ptr != cur_ptr + 1)
+            is_contiguous = 0;
 
-    
-    int  prev_ptr      = ind;
-    int  cur_free_ptr  = list->free_ptr;
+        elem_t val = 0;
 
-    list->free_ptr = list->data[cur_free_ptr].next;  
-    
-    Init_node (list->data + cur_free_ptr, 
-               val, list->data[prev_ptr].next, prev_ptr);
-    
-    int next_ptr = list->data[cur_free_ptr].next;
+        if (vals != nullptr)
+            val = vals[it];
+        else
+        {
+            val         = Node_val (src_list, src_cur_ptr);
+            src_cur_ptr = Node_next (src_list, src_cur_ptr);
+        }
 
-    list->data[next_ptr].prev = cur_free_ptr;
-    list->data[prev_ptr].next = cur_free_ptr;
-    
-    list->head_ptr = list->data[Dummy_element].next;
-    list->tail_ptr = list->data[Dummy_element].prev;
+        Init_node (list, cur_free_ptr, val, Dummy_element, cur_ptr);
+        Node_next (list, cur_ptr) = cur_free_ptr;
 
-    list->size_data++;
-    list->cnt_free_nodes--;
+        List_index_on_insert   (list, cur_ptr, cur_free_ptr);
+        List_handles_on_insert (list, cur_free_ptr);
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: List_insert_befor_ind,"
-                        " ind = %d, val = %d\n", ind, val);
-        return LIST_INSERT_ERR;
-    }
+        if (it == 0) first_ptr = cur_free_ptr;
 
-    return cur_free_ptr;
-}
+        cur_ptr = cur_free_ptr;
+    }
 
-//======================================================================================
+    link_t last_ptr = cur_ptr;
 
-int List_insert_front (List *list, const elem_t val) 
-{
-    assert (list != nullptr && "list is nullptr");
+    Node_next (list, last_ptr) = next_ptr;
+    Node_prev (list, next_ptr) = last_ptr;
 
-    if (Check_list (list))
+    //The run keeps the list linearized only if it continues the physical order
+    if (list->size_data != 0)
     {
-        REPORT ("ENTRY\nFROM: List_insert_front %d\n", val);
-        return LIST_INSERT_ERR;
+        if (!is_contiguous)
+            list->is_linearized = 0;
+
+        else if (!(prev_ptr == list->tail_ptr     && first_ptr == list->tail_ptr + 1) &&
+                 !(prev_ptr == Dummy_element      && last_ptr  == list->head_ptr - 1))
+            list->is_linearized = 0;
     }
-    
-    int ver_resize = List_resize (list);
-    if (List_recalloc (list, ver_resize))
-    {
-        Log_report ("Recalloc error\n");
-        Err_report ();
-        return LIST_INSERT_ERR;
-    } 
-        
-    if (list->size_data != 0)
-        list->is_linearized = 0;
+    else
+        list->is_linearized = is_contiguous;
 
-    
-    int  prev_ptr      = Dummy_element;
-    int  cur_free_ptr  = list->free_ptr;
+    List_prefix_cut (list, prev_ptr);
 
-    list->free_ptr = list->data[cur_free_ptr].next;  
-    
-    Init_node (list->data + cur_free_ptr, 
-               val, list->data[prev_ptr].next, prev_ptr);
-    
-    int next_ptr = list->data[cur_free_ptr].next;
+    if (prev_ptr == list->linear_prefix && is_contiguous && first_ptr == prev_ptr + 1)
+        list->linear_prefix = last_ptr;
 
-    list->data[next_ptr].prev = cur_free_ptr;
-    list->data[prev_ptr].next = cur_free_ptr;
+    List_dirty_mark (list, first_ptr);
+    List_dirty_mark (list, last_ptr);
+    List_dirty_mark (list, prev_ptr);
+    List_dirty_mark (list, next_ptr);
+    List_dirty_mark (list, list->free_ptr);
     
-    list->head_ptr = list->data[Dummy_element].next;
-    list->tail_ptr = list->data[Dummy_element].prev;
-
-    list->size_data++;
-    list->cnt_free_nodes--;
+    list->head_ptr = Node_next (list, Dummy_element);
+    list->tail_ptr = Node_prev (list, Dummy_element);
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: List_insert_front %d\n", val);
-        return LIST_INSERT_ERR;
-    }
+    list->size_data      += cnt_vals;
+    list->cnt_free_nodes -= cnt_vals;
 
-    return cur_free_ptr;
+    return first_ptr;
 }
 
 //======================================================================================
 
-int List_insert_back (List *list, const elem_t val) 
+static link_t List_pop_free_node (List *list, const link_t prev_ptr, const link_t next_ptr)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_list (list))
-    {
-        REPORT ("ENTRY\nFROM: List_insert_back %d\n", val);
-        return LIST_INSERT_ERR;
-    }
+    //The node is taken physically close to its logical neighbours, so traversals stay sequential after churn
+    link_t cur_free_ptr = Identifier_free_node;
 
-    int ver_resize = List_resize (list);
-    if (List_recalloc (list, ver_resize))
+    if (prev_ptr != Dummy_element)
     {
-        Log_report ("Recalloc error\n");
-        Err_report ();
-        return LIST_INSERT_ERR;
-    } 
-    
-    int  prev_ptr      = list->tail_ptr;
-    int  cur_free_ptr  = list->free_ptr;
+        cur_free_ptr = List_find_free_after (list, prev_ptr);
 
-    list->free_ptr = list->data[cur_free_ptr].next;  
-    
-    Init_node (list->data + cur_free_ptr, 
-               val, list->data[prev_ptr].next, prev_ptr);
-    
-    int next_ptr = list->data[cur_free_ptr].next;
+        if (cur_free_ptr == Identifier_free_node)
+            cur_free_ptr = List_find_free_before (list, prev_ptr);
+    }
+    else
+    {
+        cur_free_ptr = List_find_free_before (list, next_ptr);
 
-    list->data[next_ptr].prev = cur_free_ptr;
-    list->data[prev_ptr].next = cur_free_ptr;
-    
-    list->head_ptr = list->data[Dummy_element].next;
-    list->tail_ptr = list->data[Dummy_element].prev;
+        if (cur_free_ptr == Identifier_free_node)
+            cur_free_ptr = List_find_free_after (list, next_ptr);
+    }
 
-    list->size_data++;
-    list->cnt_free_nodes--;
+    if (cur_free_ptr == Identifier_free_node)
+        cur_free_ptr = (list->free_ptr != Identifier_free_node) ? list->free_ptr : list->bump_ptr;
 
-    if (Check_list (list))
+    //Nodes from bump_ptr have not been used since List_clear
+    if (cur_free_ptr == list->bump_ptr)
     {
-        REPORT ("EXIT\nFROM: List_insert_back %d\n", val);
-        return LIST_INSERT_ERR;
+        list->bump_ptr++;
+        Occupancy_set (list, cur_free_ptr);
     }
+    else
+        List_unlink_free_node (list, cur_free_ptr);
 
     return cur_free_ptr;
 }
 
 //======================================================================================
 
-int List_erase (List *list, const int ind) 
+static void List_push_free_node (List *list, const link_t ind)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_list (list))
-    {
-        REPORT ("ENTRY\nFROM: List_erase, ind = %d\n", ind);
-        return LIST_ERASE_ERR;
-    }   
-    
-    if (!Check_correct_ind (list, ind))
-    {
-        Log_report ("Incorrect ind = %d\n", ind);
-        return LIST_ERASE_ERR;
-    }
-
-
-    if (list->data[ind].prev == Identifier_free_node)
-    {
-        Log_report ("There is nothing at this pointer: %d.\n" 
-                    "You cannot free a previously freed node\n", ind);
-        return LIST_ERASE_ERR;
-    }
+    Init_node (list, ind, Poison_val, list->free_ptr, Identifier_free_node);
 
+    if (list->free_ptr != Identifier_free_node)
+        Node_prev (list, list->free_ptr) = Identifier_free_node - ind;
 
-    if (list->head_ptr != ind && list->tail_ptr != ind)
-        list->is_linearized = 0;
-    
-
-    int ver_resize = List_resize (list);
-    if (List_recalloc (list, ver_resize))
-    {
-        Log_report ("Recalloc error\n");
-        Err_report ();
-        return LIST_INSERT_ERR;
-    }
+    list->free_ptr = ind;
 
+    Occupancy_reset (list, ind);
 
-    int  cur_ptr   = ind;
-    int  prev_ptr  = list->data[ind].prev;
-    int  next_ptr  = list->data[ind].next;
+    return;
+}
 
-    list->data[prev_ptr].next = next_ptr;
-    list->data[next_ptr].prev = prev_ptr;
+//======================================================================================
 
-    Init_node (list->data + cur_ptr, 
-               Poison_val, list->free_ptr, Identifier_free_node);
+static void List_unlink_free_node (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
 
-    list->free_ptr = cur_ptr;
+    link_t prev_free_ptr = Identifier_free_node - Node_prev (list, ind);     //<- Dummy_element means free_ptr
+    link_t next_free_ptr = Node_next (list, ind);
 
-    list->head_ptr = list->data[Dummy_element].next;
-    list->tail_ptr = list->data[Dummy_element].prev;
+    if (prev_free_ptr == Dummy_element)
+        list->free_ptr = next_free_ptr;
+    else
+        Node_next (list, prev_free_ptr) = next_free_ptr;
 
-    list->size_data--;
-    list->cnt_free_nodes++;
+    if (next_free_ptr != Identifier_free_node)
+        Node_prev (list, next_free_ptr) = Identifier_free_node - prev_free_ptr;
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: List_erase exit, ind = %d\n", ind);
-        return LIST_ERASE_ERR;
-    }  
+    Occupancy_set (list, ind);
 
-    return 0;
+    return;
 }
 
 //======================================================================================
 
-static int List_resize (List *list)
+static int Is_free_node (const List *list, const link_t ind)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_list (list))
-    {
-        REPORT ("ENTRY\nFROM: List_resize\n");
-        return LIST_RESIZE_ERR;
-    }   
-
-    if (list->capacity / 4  <= list->size_data   && 
-        list->size_data + 1 < list->capacity / 2 && 
-        list->is_linearized == 1)
-    {
-        list->capacity = list->capacity / 2 + 1;
-        return 1;
-    } 
-
-    if (list->capacity == list->size_data + 1)
-    {
-        list->capacity = list->capacity * 2 + 1;
-        return 1;
-    }
+    return Node_prev (list, ind) <= Identifier_free_node;
+}
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: List_resize\n");
-        return LIST_RESIZE_ERR;
-    }  
+//======================================================================================
 
-    return 0;
+static size_t Occupancy_words (const long capacity)
+{
+    return (size_t) (capacity + 1 + 63) / 64;     //<- Bits of the nodes 0..capacity
 }
 
 //======================================================================================
 
-static int List_recalloc (List *list, int resize_status)
+static int List_occupancy_realloc (List *list, const long new_capacity)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_list (list))
+    size_t old_words = Occupancy_words (list->capacity);
+    size_t new_words = Occupancy_words (new_capacity);
+
+    if (new_words == old_words) return 0;
+
+    uint64_t *new_occupancy = (uint64_t*) realloc (list->occupancy, new_words * sizeof (uint64_t));
+
+    if (Check_nullptr (new_occupancy))
+        return (new_words > old_words) ? ERR_MEMORY_ALLOC : 0;      //<- A larger bitmap is kept on shrink
+
+    if (new_words > old_words)
+        memset (new_occupancy + old_words, 0, (new_words - old_words) * sizeof (uint64_t));
+
+    list->occupancy = new_occupancy;
+
+    return 0;
+}
+
+//======================================================================================
+
+static void Occupancy_set (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    list->occupancy[ind / 64] |= (uint64_t) 1 << (ind % 64);
+
+    return;
+}
+
+//======================================================================================
+
+static void Occupancy_reset (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    list->occupancy[ind / 64] &= ~((uint64_t) 1 << (ind % 64));
+
+    return;
+}
+
+//======================================================================================
+
+static int Is_occupied (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return (int) ((list->occupancy[ind / 64] >> (ind % 64)) & 1);
+}
+
+//======================================================================================
+
+static long Occupancy_count (const List *list, const link_t first_ind, const link_t last_ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (first_ind > last_ind) return 0;
+
+    long first_word = first_ind / 64;
+    long last_word  = last_ind  / 64;
+
+    uint64_t first_mask = ~(uint64_t) 0 << (first_ind % 64);
+    uint64_t last_mask  = ~(uint64_t) 0 >> (63 - last_ind % 64);
+
+    if (first_word == last_word)
+        return __builtin_popcountll (list->occupancy[first_word] & first_mask & last_mask);
+
+    long cnt_live = __builtin_popcountll (list->occupancy[first_word] & first_mask) +
+                    __builtin_popcountll (list->occupancy[last_word]  & last_mask);
+
+    for (long word = first_word + 1; word < last_word; word++)
+        cnt_live += __builtin_popcountll (list->occupancy[word]);
+
+    return cnt_live;
+}
+
+//======================================================================================
+
+static link_t List_find_free_after (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    //Free nodes lie in [1, bump_ptr), bump_ptr itself is the first unused one
+    long last_ind = (list->bump_ptr <= list->capacity) ? list->bump_ptr : list->bump_ptr - 1;
+    long first_ind = (long) ind + 1;
+
+    if (first_ind > last_ind) return Identifier_free_node;
+
+    long first_word = first_ind / 64;
+    long last_word  = last_ind  / 64;
+
+    if (last_word > first_word + LIST_ALLOC_WINDOW)
+        last_word = first_word + LIST_ALLOC_WINDOW;
+
+    for (long word = first_word; word <= last_word; word++)
     {
-        REPORT ("ENTRY\nFROM: List_recalloc\n");
-        return LIST_RECALLOC_ERR;
-    } 
+        uint64_t free_bits = ~list->occupancy[word];
+
+        if (word == first_word)
+            free_bits &= ~(uint64_t) 0 << (first_ind % 64);
+
+        if (free_bits == 0) continue;
+
+        long free_ind = word * 64 + __builtin_ctzll (free_bits);
+
+        return (free_ind <= last_ind) ? (link_t) free_ind : Identifier_free_node;
+    }
+
+    return Identifier_free_node;
+}
+
+//======================================================================================
+
+static link_t List_find_free_before (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long last_ind = (long) ind - 1;
+
+    if (last_ind > (long) list->bump_ptr - 1)
+        last_ind = (long) list->bump_ptr - 1;
+
+    if (last_ind < 1) return Identifier_free_node;
+
+    long last_word  = last_ind / 64;
+    long first_word = (last_word > LIST_ALLOC_WINDOW) ? last_word - LIST_ALLOC_WINDOW : 0;
+
+    for (long word = last_word; word >= first_word; word--)
+    {
+        uint64_t free_bits = ~list->occupancy[word];
+
+        if (word == last_word)
+            free_bits &= ~(uint64_t) 0 >> (63 - last_ind % 64);
+
+        if (word == 0)
+            free_bits &= ~(uint64_t) 1;             //<- Dummy_element is never free
+
+        if (free_bits == 0) continue;
+
+        return (link_t) (word * 64 + 63 - __builtin_clzll (free_bits));
+    }
+
+    return Identifier_free_node;
+}
+
+//======================================================================================
+
+link_t List_insert_befor_ind (List *list, const link_t ind, const elem_t val) 
+{
+    assert (list != nullptr && "list is nullptr");
 
-    if (resize_status == 0) return 0;
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_insert_befor_ind,"
+                        " ind = %" LINK_T_SPEC ", val = %d\n", ind, val);
+        return LIST_INSERT_ERR;
+    }
 
-    if (resize_status < 0)
+    List_dirty_reset (list);
+    
+    if (List_recalloc (list, List_resize (list)))
     {
-        Log_report ("The list is not subject to recalloc\n");
+        Log_report ("Recalloc error\n");
         Err_report ();
-        return LIST_RECALLOC_ERR;
+        return LIST_INSERT_ERR;
+    } 
+
+    if (!Check_correct_ind (list, ind) && ind != Dummy_element)
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_INSERT_ERR;
+    }
+
+    if (Is_free_node (list, ind))
+    {
+        Log_report ("There is nothing at this pointer: %" LINK_T_SPEC ".\n" 
+                    "You can only add an element before initialized elements\n", ind);
+        return LIST_INSERT_ERR;
     }
 
-    list->data = (Node*) realloc (list->data, (list->capacity + 1) * sizeof (Node));
+    link_t prev_ptr = ind;         //<- The node can be moved by the linearization step
 
-    if (Check_nullptr (list->data))
+    if (List_linearize_run (list, list->linearize_budget, &prev_ptr))
     {
-        Log_report ("List data is nullptr after use recalloc\n");
+        Log_report ("Linearization step error\n");
         Err_report ();
-        return ERR_MEMORY_ALLOC;
+        return LIST_INSERT_ERR;
+    }
+
+    link_t cur_ptr = List_link_run (list, prev_ptr, &val, nullptr, Dummy_element, 1);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_insert_befor_ind,"
+                        " ind = %" LINK_T_SPEC ", val = %d\n", ind, val);
+        return LIST_INSERT_ERR;
+    }
+
+    return cur_ptr;
+}
+
+//======================================================================================
+
+link_t List_insert_front (List *list, const elem_t val) 
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_insert_front %d\n", val);
+        return LIST_INSERT_ERR;
     }
 
+    List_dirty_reset (list);
     
-    list->cnt_free_nodes = 0;
-    if (Init_list_data (list))
+    if (List_recalloc (list, List_resize (list)))
     {
-        Log_report ("List data initialization error\n");
+        Log_report ("Recalloc error\n");
         Err_report ();
-        return LIST_RECALLOC_ERR;
+        return LIST_INSERT_ERR;
+    } 
+
+    if (List_linearize_run (list, list->linearize_budget, nullptr))
+    {
+        Log_report ("Linearization step error\n");
+        Err_report ();
+        return LIST_INSERT_ERR;
+    }
+
+    link_t cur_ptr = List_link_run (list, Dummy_element, &val, nullptr, Dummy_element, 1);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_insert_front %d\n", val);
+        return LIST_INSERT_ERR;
     }
 
+    return cur_ptr;
+}
+
+//======================================================================================
+
+link_t List_insert_back (List *list, const elem_t val) 
+{
+    assert (list != nullptr && "list is nullptr");
+
     if (Check_list (list))
     {
-        REPORT ("EXIT\nFROM: List_recalloc\n");
-        return LIST_RECALLOC_ERR;
+        REPORT ("ENTRY\nFROM: List_insert_back %d\n", val);
+        return LIST_INSERT_ERR;
+    }
+
+    List_dirty_reset (list);
+
+    if (List_recalloc (list, List_resize (list)))
+    {
+        Log_report ("Recalloc error\n");
+        Err_report ();
+        return LIST_INSERT_ERR;
     } 
 
-    return 0;
+    if (List_linearize_run (list, list->linearize_budget, nullptr))
+    {
+        Log_report ("Linearization step error\n");
+        Err_report ();
+        return LIST_INSERT_ERR;
+    }
+
+    link_t cur_ptr = List_link_run (list, list->tail_ptr, &val, nullptr, Dummy_element, 1);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_insert_back %d\n", val);
+        return LIST_INSERT_ERR;
+    }
+
+    return cur_ptr;
 }
 
 //======================================================================================
 
-int List_linearize (List *list)
+link_t List_insert_before_n (List *list, const link_t ind, const elem_t *vals, const long cnt_vals) 
 {
-    assert (list != nullptr && "list is nullptr\n");
+    assert (list != nullptr && "list is nullptr");
 
     if (Check_list (list))
     {
-        REPORT ("ENTRY\nFROM: List_linearize\n");
-        return LIST_LINEARIZE_ERR;
-    } 
+        REPORT ("ENTRY\nFROM: List_insert_before_n,"
+                        " ind = %" LINK_T_SPEC ", cnt_vals = %ld\n", ind, cnt_vals);
+        return LIST_INSERT_ERR;
+    }
 
-    if (list->is_linearized == 1) 
-        return 0;
+    if (cnt_vals < 0 || (cnt_vals > 0 && vals == nullptr))
+    {
+        Log_report ("Incorrect values array: %p, cnt_vals = %ld\n", (const void*) vals, cnt_vals);
+        return LIST_INSERT_ERR;
+    }
+
+    if (!Check_correct_ind (list, ind) && ind != Dummy_element)
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_INSERT_ERR;
+    }
 
-    Node* new_data = (Node*) calloc (list->capacity + 1, sizeof (Node));
+    if (Is_free_node (list, ind))
+    {
+        Log_report ("There is nothing at this pointer: %" LINK_T_SPEC ".\n" 
+                    "You can only add elements before initialized elements\n", ind);
+        return LIST_INSERT_ERR;
+    }
+
+    if (cnt_vals == 0) return Dummy_element;
 
-    if (Check_nullptr (new_data))
+    List_dirty_reset (list);
+
+    if (List_reserve_nodes (list, cnt_vals))
     {
-        Log_report ("Linearize error, new data memory allocation error\n");
+        Log_report ("Reserve error, cnt_vals = %ld\n", cnt_vals);
         Err_report ();
-        return ERR_MEMORY_ALLOC;
+        return LIST_INSERT_ERR;
+    } 
+
+    link_t first_ptr = List_link_run (list, ind, vals, nullptr, Dummy_element, cnt_vals);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_insert_before_n,"
+                        " ind = %" LINK_T_SPEC ", cnt_vals = %ld\n", ind, cnt_vals);
+        return LIST_INSERT_ERR;
     }
 
-    int logical_ind = list->head_ptr;
+    return first_ptr;
+}
+
+//======================================================================================
+
+link_t List_insert_front_n (List *list, const elem_t *vals, const long cnt_vals) 
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return List_insert_before_n (list, Dummy_element, vals, cnt_vals);
+}
+
+//======================================================================================
+
+link_t List_insert_back_n (List *list, const elem_t *vals, const long cnt_vals) 
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return List_insert_before_n (list, list->tail_ptr, vals, cnt_vals);
+}
 
-    Init_node (new_data, Poison_val, 1, list->size_data);
+//======================================================================================
 
-    int counter = 1;
+int List_erase (List *list, const link_t ind) 
+{
+    assert (list != nullptr && "list is nullptr");
 
-    while (counter <= list->size_data - 1)
+    if (Check_list (list))
     {
-        Init_node (new_data + counter, 
-                   list->data[logical_ind].val, counter + 1, counter - 1);
-        counter++;
+        REPORT ("ENTRY\nFROM: List_erase, ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_ERASE_ERR;
+    }   
+
+    List_dirty_reset (list);
+    
+    if (!Check_correct_ind (list, ind))
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_ERASE_ERR;
+    }
+
+
+    if (Is_free_node (list, ind))
+    {
+        Log_report ("There is nothing at this pointer: %" LINK_T_SPEC ".\n" 
+                    "You cannot free a previously freed node\n", ind);
+        return LIST_ERASE_ERR;
+    }
+
+    link_t cur_ptr   = ind;       //<- The node can be moved by the linearization step
+
+    if (List_linearize_run (list, list->linearize_budget, &cur_ptr))
+    {
+        Log_report ("Linearization step error\n");
+        Err_report ();
+        return LIST_ERASE_ERR;
+    }
+
+
+    if (list->head_ptr != cur_ptr && list->tail_ptr != cur_ptr)
+        list->is_linearized = 0;
+    
+
+    if (List_recalloc (list, List_resize (list)))
+    {
+        Log_report ("Recalloc error\n");
+        Err_report ();
+        return LIST_ERASE_ERR;
+    }
+
+
+    link_t prev_ptr  = Node_prev (list, cur_ptr);
+    link_t next_ptr  = Node_next (list, cur_ptr);
+
+    Node_next (list, prev_ptr) = next_ptr;
+    Node_prev (list, next_ptr) = prev_ptr;
+
+    List_index_on_erase   (list, cur_ptr);
+    List_handles_on_erase (list, cur_ptr);
+
+    List_push_free_node (list, cur_ptr);
+
+    List_prefix_cut (list, cur_ptr - 1);
+
+    List_dirty_mark (list, cur_ptr);
+    List_dirty_mark (list, prev_ptr);
+    List_dirty_mark (list, next_ptr);
+
+    list->head_ptr = Node_next (list, Dummy_element);
+    list->tail_ptr = Node_prev (list, Dummy_element);
+
+    list->size_data--;
+    list->cnt_free_nodes++;
+
+    if (list->linear_prefix == list->size_data)
+        list->is_linearized = 1;
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_erase exit, ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_ERASE_ERR;
+    }  
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_erase_range (List *list, const link_t first_ind, const link_t last_ind) 
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_erase_range,"
+                " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_ERASE_ERR;
+    }   
+
+    List_dirty_reset (list);
+    
+    if (!Check_correct_ind (list, first_ind) || !Check_correct_ind (list, last_ind))
+    {
+        Log_report ("Incorrect range: first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_ERASE_ERR;
+    }
+
+    if (Is_free_node (list, first_ind) || 
+        Is_free_node (list, last_ind))
+    {
+        Log_report ("There is nothing at this range: [%" LINK_T_SPEC ", %" LINK_T_SPEC "].\n" 
+                    "You cannot free a previously freed node\n", first_ind, last_ind);
+        return LIST_ERASE_ERR;
+    }
+
+    long cnt_nodes = List_count_range (list, first_ind, last_ind);
+
+    if (cnt_nodes <= 0)
+    {
+        Log_report ("last_ind = %" LINK_T_SPEC " does not follow first_ind = %" LINK_T_SPEC "\n", last_ind, first_ind);
+        return LIST_ERASE_ERR;
+    }
+
+    List_unlink_range (list, first_ind, last_ind, cnt_nodes);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_erase_range,"
+                " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_ERASE_ERR;
+    }  
+
+    return 0;
+}
+
+//======================================================================================
+
+static long List_count_range (const List *list, const link_t first_ind, const link_t last_ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long cnt_nodes = 1;
+
+    for (link_t cur_ptr = first_ind; cur_ptr != last_ind; cur_ptr = Node_next (list, cur_ptr))
+    {
+        if (Node_next (list, cur_ptr) == Dummy_element)
+            return LIST_INVALID_ERR;
+
+        cnt_nodes++;
+    }
+
+    return cnt_nodes;
+}
+
+//======================================================================================
+
+static void List_unlink_range (List *list, const link_t first_ind, const link_t last_ind, const long cnt_nodes)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    link_t prev_ptr  = Node_prev (list, first_ind);
+    link_t next_ptr  = Node_next (list, last_ind);
+
+    if (prev_ptr != Dummy_element && next_ptr != Dummy_element)
+        list->is_linearized = 0;
+
+    Node_next (list, prev_ptr) = next_ptr;
+    Node_prev (list, next_ptr) = prev_ptr;
+
+    //Erased nodes are already chained by next, only free markers are written
+    link_t prev_free_ptr = Dummy_element;
+
+    for (link_t cur_ptr = first_ind; cur_ptr != last_ind; cur_ptr = Node_next (list, cur_ptr))
+    {
+        Node_val (list, cur_ptr)  = Poison_val;
+        Node_prev (list, cur_ptr) = Identifier_free_node - prev_free_ptr;
+
+        Occupancy_reset (list, cur_ptr);
+
+        List_index_on_erase   (list, cur_ptr);
+        List_handles_on_erase (list, cur_ptr);
+
+        prev_free_ptr = cur_ptr;
+    }
+
+    List_index_on_erase   (list, last_ind);
+    List_handles_on_erase (list, last_ind);
+
+    Init_node (list, last_ind, 
+               Poison_val, list->free_ptr, Identifier_free_node - prev_free_ptr);
+
+    Occupancy_reset (list, last_ind);
+
+    if (list->free_ptr != Identifier_free_node)
+        Node_prev (list, list->free_ptr) = Identifier_free_node - last_ind;
+
+    list->free_ptr = first_ind;
+
+    List_prefix_cut (list, first_ind - 1);
+
+    List_dirty_mark (list, first_ind);
+    List_dirty_mark (list, last_ind);
+    List_dirty_mark (list, prev_ptr);
+    List_dirty_mark (list, next_ptr);
+
+    list->head_ptr = Node_next (list, Dummy_element);
+    list->tail_ptr = Node_prev (list, Dummy_element);
+
+    list->size_data      -= cnt_nodes;
+    list->cnt_free_nodes += cnt_nodes;
+
+    if (list->linear_prefix == list->size_data)
+        list->is_linearized = 1;
+
+    return;
+}
+
+//======================================================================================
+
+int List_clear (List *list) 
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_clear\n");
+        return DATA_CLEAR_ERR;
+    }   
+
+    List_dirty_reset (list);
+
+    Init_node (list, Dummy_element, Poison_val, Dummy_element, Dummy_element);
+
+    list->head_ptr = Dummy_element;
+    list->tail_ptr = Dummy_element;
+
+    //All nodes become free without a walk over them, only the used words of the bitmap are zeroed
+    memset (list->occupancy, 0, Occupancy_words (list->bump_ptr - 1) * sizeof (uint64_t));
+
+    list->free_ptr = Identifier_free_node;
+    list->bump_ptr = 1;
+
+    list->size_data      = 0;
+    list->cnt_free_nodes = list->capacity;
+
+    list->is_linearized = 1;
+    list->linear_prefix = 0;
+
+    if (list->index != nullptr)
+        List_index_clear (list->index);
+
+    if (list->handles != nullptr)
+        List_handles_clear (list->handles);
+
+    List_dirty_mark (list, Dummy_element);
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_clear\n");
+        return DATA_CLEAR_ERR;
+    }  
+
+    return 0;
+}
+
+//======================================================================================
+
+link_t List_splice (List *list, const link_t ind, List *src_list, const link_t first_ind, const link_t last_ind)
+{
+    assert (list     != nullptr && "list is nullptr");
+    assert (src_list != nullptr && "src_list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_splice, ind = %" LINK_T_SPEC ","
+                " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", ind, first_ind, last_ind);
+        return LIST_SPLICE_ERR;
+    }
+
+    if (Check_list (src_list))
+    {
+        List_dump (src_list, "ENTRY\nFROM: List_splice, source list,"
+                             " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        Err_report ();
+        return LIST_SPLICE_ERR;
+    }
+
+    if ((!Check_correct_ind (list, ind) && ind != Dummy_element) ||
+        Is_free_node (list, ind))
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return LIST_SPLICE_ERR;
+    }
+
+    if (!Check_correct_ind (src_list, first_ind) || !Check_correct_ind (src_list, last_ind) ||
+        Is_free_node (src_list, first_ind)                                        ||
+        Is_free_node (src_list, last_ind))
+    {
+        Log_report ("Incorrect range: first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_SPLICE_ERR;
+    }
+
+    long cnt_nodes = List_count_range (src_list, first_ind, last_ind);
+
+    if (cnt_nodes <= 0)
+    {
+        Log_report ("last_ind = %" LINK_T_SPEC " does not follow first_ind = %" LINK_T_SPEC "\n", last_ind, first_ind);
+        return LIST_SPLICE_ERR;
+    }
+
+    List_dirty_reset (list);
+
+    if (src_list == list)
+    {
+        if (List_relink_range (list, ind, first_ind, last_ind))
+        {
+            Log_report ("ind = %" LINK_T_SPEC " lies in the moved range [%" LINK_T_SPEC ", %" LINK_T_SPEC "]\n", ind, first_ind, last_ind);
+            return LIST_SPLICE_ERR;
+        }
+    }
+    else
+    {
+        List_dirty_reset (src_list);
+
+        if (List_reserve_nodes (list, cnt_nodes))
+        {
+            Log_report ("Reserve error, cnt_nodes = %ld\n", cnt_nodes);
+            Err_report ();
+            return LIST_SPLICE_ERR;
+        } 
+
+        //Each list owns its nodes, so the values are copied to the free nodes of list
+        link_t first_ptr = List_link_run (list, ind, nullptr, src_list, first_ind, cnt_nodes);
+
+        List_unlink_range (src_list, first_ind, last_ind, cnt_nodes);
+
+        if (Check_list_exit (src_list))
+        {
+            List_dump (src_list, "EXIT\nFROM: List_splice, source list,"
+                                 " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+            Err_report ();
+            return LIST_SPLICE_ERR;
+        }
+
+        if (Check_list_exit (list))
+        {
+            REPORT ("EXIT\nFROM: List_splice, ind = %" LINK_T_SPEC ","
+                    " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", ind, first_ind, last_ind);
+            return LIST_SPLICE_ERR;
+        }
+
+        return first_ptr;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_splice, ind = %" LINK_T_SPEC ","
+                " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", ind, first_ind, last_ind);
+        return LIST_SPLICE_ERR;
+    }
+
+    return first_ind;
+}
+
+//======================================================================================
+
+static int List_relink_range (List *list, const link_t ind, const link_t first_ind, const link_t last_ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    for (link_t cur_ptr = first_ind; ; cur_ptr = Node_next (list, cur_ptr))
+    {
+        if (cur_ptr == ind) return LIST_INVALID_ERR;
+
+        if (cur_ptr == last_ind) break;
+    }
+
+    link_t prev_ptr = Node_prev (list, first_ind);
+    link_t next_ptr = Node_next (list, last_ind);
+
+    if (prev_ptr == ind) return 0;
+
+    Node_next (list, prev_ptr) = next_ptr;
+    Node_prev (list, next_ptr) = prev_ptr;
+
+    link_t new_next_ptr = Node_next (list, ind);
+
+    Node_next (list, ind)       = first_ind;
+    Node_prev (list, first_ind) = ind;
+
+    Node_next (list, last_ind)     = new_next_ptr;
+    Node_prev (list, new_next_ptr) = last_ind;
+
+    list->is_linearized = 0;
+
+    List_prefix_cut (list, first_ind - 1);
+    List_prefix_cut (list, ind);
+
+    List_index_invalidate (list);
+
+    List_dirty_mark (list, first_ind);
+    List_dirty_mark (list, last_ind);
+    List_dirty_mark (list, prev_ptr);
+    List_dirty_mark (list, next_ptr);
+    List_dirty_mark (list, ind);
+    List_dirty_mark (list, new_next_ptr);
+
+    list->head_ptr = Node_next (list, Dummy_element);
+    list->tail_ptr = Node_prev (list, Dummy_element);
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_split (List *list, const long pos, List *tail_list)
+{
+    assert (list      != nullptr && "list is nullptr");
+    assert (tail_list != nullptr && "tail_list is nullptr");
+
+    if (tail_list == list)
+    {
+        Log_report ("The list can not be split into itself\n");
+        return LIST_SPLIT_ERR;
+    }
+
+    if (pos < 0 || pos > list->size_data)
+    {
+        Log_report ("Incorrect split position = %ld, size_data = %ld\n", pos, list->size_data);
+        return LIST_SPLIT_ERR;
+    }
+
+    if (pos == list->size_data) return 0;
+
+    link_t first_ind = Get_ind_by_logical_order (list, pos + 1);
+
+    if (first_ind < 0)
+    {
+        Log_report ("Split position search error, pos = %ld\n", pos);
+        return LIST_SPLIT_ERR;
+    }
+
+    if (List_splice (tail_list, tail_list->tail_ptr, list, first_ind, list->tail_ptr) < 0)
+    {
+        Log_report ("Splice error, pos = %ld\n", pos);
+        Err_report ();
+        return LIST_SPLIT_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_merge (List *list, List *src_list, Elem_cmp_t cmp)
+{
+    assert (list     != nullptr && "list is nullptr");
+    assert (src_list != nullptr && "src_list is nullptr");
+
+    if (cmp == nullptr) cmp = Elem_cmp_default;
+
+    if (src_list == list)
+    {
+        Log_report ("The list can not be merged with itself\n");
+        return LIST_MERGE_ERR;
+    }
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_merge\n");
+        return LIST_MERGE_ERR;
+    }
+
+    if (Check_list (src_list))
+    {
+        List_dump (src_list, "ENTRY\nFROM: List_merge, source list\n");
+        Err_report ();
+        return LIST_MERGE_ERR;
+    }
+
+    List_dirty_reset (list);
+
+    if (List_reserve_nodes (list, src_list->size_data))
+    {
+        Log_report ("Reserve error, cnt_nodes = %ld\n", src_list->size_data);
+        Err_report ();
+        return LIST_MERGE_ERR;
+    } 
+
+    List_dirty_mark_all (list);
+
+    link_t cur_ptr     = list->head_ptr;
+    link_t src_cur_ptr = src_list->head_ptr;
+
+    while (src_cur_ptr != Dummy_element)
+    {
+        elem_t src_val = Node_val (src_list, src_cur_ptr);
+
+        //Equal values of list go first
+        while (cur_ptr != Dummy_element && cmp (Node_val (list, cur_ptr), src_val) <= 0)
+            cur_ptr = Node_next (list, cur_ptr);
+
+        link_t run_first_ptr = src_cur_ptr;
+        long cnt_run_nodes = 0;
+
+        while (src_cur_ptr != Dummy_element && 
+               (cur_ptr == Dummy_element || cmp (Node_val (src_list, src_cur_ptr), Node_val (list, cur_ptr)) < 0))
+        {
+            src_cur_ptr = Node_next (src_list, src_cur_ptr);
+            cnt_run_nodes++;
+        }
+
+        List_link_run (list, Node_prev (list, cur_ptr), nullptr, src_list, run_first_ptr, cnt_run_nodes);
+    }
+
+    if (List_clear (src_list))
+    {
+        Log_report ("Source list clear error\n");
+        Err_report ();
+        return LIST_MERGE_ERR;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_merge\n");
+        return LIST_MERGE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_sort (List *list, Elem_cmp_t cmp)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_sort\n");
+        return LIST_SORT_ERR;
+    }
+
+    //Such lists are sorted and linearized already
+    if (list->size_data < 2) return 0;
+
+    List_dirty_reset    (list);
+    List_dirty_mark_all (list);
+
+    //Radix sort moves values between nodes, so it is not used when handles follow the nodes
+    int is_radix = (cmp == nullptr && list->handles == nullptr && list->size_data >= LIST_SORT_RADIX_MIN_NODES);
+
+    if (is_radix && (list->is_linearized == 0 || list->head_ptr > 1) && List_compact (list))
+    {
+        Log_report ("Linearization error\n");
+        Err_report ();
+        return LIST_SORT_ERR;
+    }
+
+    if (!is_radix || List_radix_sort (list))
+    {
+        List_merge_sort (list, (cmp == nullptr) ? Elem_cmp_default : cmp);
+
+        if (List_compact (list))
+        {
+            Log_report ("Linearization error\n");
+            Err_report ();
+            return LIST_SORT_ERR;
+        }
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_sort\n");
+        return LIST_SORT_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static void List_merge_sort (List *list, Elem_cmp_t cmp)
+{
+    assert (list != nullptr && "list is nullptr");
+    assert (cmp  != nullptr && "cmp is nullptr");
+
+    //runs[i] is a sorted run of 2^i nodes linked by next only, the runs are merged like a binary counter,
+    //so the merged nodes were visited recently and are still in the cache
+    const int Max_runs = 64;
+
+    link_t runs[Max_runs] = {};
+
+    link_t cur_ptr = list->head_ptr;
+
+    while (cur_ptr != Dummy_element)
+    {
+        link_t next_ptr = Node_next (list, cur_ptr);
+        Node_next (list, cur_ptr) = Dummy_element;
+
+        link_t run = cur_ptr;
+        int run_ind = 0;
+
+        for (; run_ind < Max_runs - 1 && runs[run_ind] != Dummy_element; run_ind++)
+        {
+            run = List_merge_runs (list, runs[run_ind], run, cmp);
+            runs[run_ind] = Dummy_element;
+        }
+
+        runs[run_ind] = run;
+        cur_ptr = next_ptr;
+    }
+
+    //Longer runs hold earlier nodes
+    link_t sorted = Dummy_element;
+
+    for (int run_ind = 0; run_ind < Max_runs; run_ind++)
+        if (runs[run_ind] != Dummy_element)
+            sorted = List_merge_runs (list, runs[run_ind], sorted, cmp);
+
+    link_t prev_ptr = Dummy_element;
+
+    for (cur_ptr = sorted; cur_ptr != Dummy_element; cur_ptr = Node_next (list, cur_ptr))
+    {
+        Node_prev (list, cur_ptr) = prev_ptr;
+        prev_ptr = cur_ptr;
+    }
+
+    Node_next (list, Dummy_element) = sorted;
+    Node_prev (list, Dummy_element) = prev_ptr;
+
+    list->head_ptr = sorted;
+    list->tail_ptr = prev_ptr;
+
+    list->is_linearized = 0;
+
+    List_prefix_cut (list, Dummy_element);
+
+    List_index_invalidate (list);
+
+    return;
+}
+
+//======================================================================================
+
+static link_t List_merge_runs (List *list, link_t first_run, link_t second_run, Elem_cmp_t cmp)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    //Next of Dummy_element holds the head of the merged run, the links of Dummy_element are restored by List_merge_sort
+    link_t tail_ptr = Dummy_element;
+
+    while (first_run != Dummy_element && second_run != Dummy_element)
+    {
+        //Nodes of first_run go first if the values are equal
+        if (cmp (Node_val (list, second_run), Node_val (list, first_run)) < 0)
+        {
+            Node_next (list, tail_ptr) = second_run;
+            tail_ptr   = second_run;
+            second_run = Node_next (list, second_run);
+        }
+        else
+        {
+            Node_next (list, tail_ptr) = first_run;
+            tail_ptr  = first_run;
+            first_run = Node_next (list, first_run);
+        }
+    }
+
+    Node_next (list, tail_ptr) = (first_run != Dummy_element) ? first_run : second_run;
+
+    return Node_next (list, Dummy_element);
+}
+
+//======================================================================================
+
+static int List_radix_sort (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long cnt_vals = list->size_data;
+
+    elem_t *vals = (elem_t*) calloc ((size_t) cnt_vals, sizeof (elem_t));
+    elem_t *buf  = (elem_t*) calloc ((size_t) cnt_vals, sizeof (elem_t));
+
+    if (Check_nullptr (vals) || Check_nullptr (buf))
+    {
+        free (vals);
+        free (buf);
+        return LIST_SORT_ERR;
+    }
+
+    //The list is linearized, its values lie in the nodes 1..size_data
+    for (long it = 0; it < cnt_vals; it++)
+        vals[it] = Node_val (list, (link_t) (it + 1));
+
+    int is_sorted = (Radix_sort_vals (vals, buf, cnt_vals) == 0);
+
+    if (is_sorted)
+        for (long it = 0; it < cnt_vals; it++)
+            Node_val (list, (link_t) (it + 1)) = vals[it];
+
+    free (vals);
+    free (buf);
+
+    return is_sorted ? 0 : LIST_SORT_ERR;
+}
+
+//======================================================================================
+
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value, int>::type
+Radix_sort_vals (T *vals, T *buf, const long cnt_vals)
+{
+    assert (vals != nullptr && "vals is nullptr");
+    assert (buf  != nullptr && "buf is nullptr");
+
+    typedef typename std::make_unsigned<T>::type radix_key_t;
+
+    //The sign bit is flipped, so negative values go before positive ones
+    const radix_key_t sign_bit = std::is_signed<T>::value ? (radix_key_t) ((radix_key_t) 1 << (8 * sizeof (T) - 1)) : (radix_key_t) 0;
+
+    T *src = vals;
+    T *dst = buf;
+
+    for (size_t shift = 0; shift < 8 * sizeof (T); shift += 8)
+    {
+        long counts[256] = {};
+
+        for (long it = 0; it < cnt_vals; it++)
+            counts[(((radix_key_t) src[it] ^ sign_bit) >> shift) & 0xFF]++;
+
+        //All values have the same byte, the pass would not move them
+        if (counts[(((radix_key_t) src[0] ^ sign_bit) >> shift) & 0xFF] == cnt_vals) continue;
+
+        long pos = 0;
+
+        for (int digit = 0; digit < 256; digit++)
+        {
+            long cnt_digit = counts[digit];
+
+            counts[digit] = pos;
+            pos += cnt_digit;
+        }
+
+        for (long it = 0; it < cnt_vals; it++)
+            dst[counts[(((radix_key_t) src[it] ^ sign_bit) >> shift) & 0xFF]++] = src[it];
+
+        T *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != vals)
+        memcpy (vals, src, (size_t) cnt_vals * sizeof (T));
+
+    return 0;
+}
+
+//======================================================================================
+
+template <typename T>
+static typename std::enable_if<!std::is_integral<T>::value, int>::type
+Radix_sort_vals (T *, T *, const long)
+{
+    //Only the bytes of integers are ordered like the values, other types are sorted by List_merge_sort
+    return LIST_SORT_ERR;
+}
+
+//======================================================================================
+
+static int Elem_cmp_default (const elem_t first, const elem_t second)
+{
+    return (first > second) - (first < second);
+}
+
+//======================================================================================
+
+static long List_resize (const List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    const List_resize_policy *policy = &list->resize_policy;
+
+    if (list->capacity == list->size_data + 1)
+        return List_next_capacity (list, list->capacity);
+
+    if (policy->shrink_ratio <= 0) return 0;
+
+    long new_capacity   = (long) ((double) list->capacity / policy->growth_factor);
+    long floor_capacity = MAX (policy->min_capacity, list->reserved_capacity);
+
+    //Only a linearized list can be cut without moving nodes
+    if ((double) (list->size_data + 1) * policy->shrink_ratio <= (double) list->capacity && 
+        new_capacity >= floor_capacity &&
+        list->is_linearized == 1       &&
+        list->tail_ptr < new_capacity)
+    {
+        return new_capacity;
+    } 
+
+    return 0;
+}
+
+//======================================================================================
+
+static long List_next_capacity (const List *list, const long capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    //The list can not grow beyond the range of link_t, List_link_run reports when it is full
+    if (capacity >= Max_list_capacity) return 0;
+
+    double new_capacity = (double) capacity * list->resize_policy.growth_factor + 1;
+
+    return (new_capacity < (double) Max_list_capacity) ? (long) new_capacity : Max_list_capacity;
+}
+
+//======================================================================================
+
+static int List_reserve_nodes (List *list, const long cnt_nodes)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long new_capacity = list->capacity;
+
+    if (cnt_nodes > Max_list_capacity - list->size_data - 1)
+    {
+        Log_report ("Too many nodes for link_t: cnt_nodes = %ld, size_data = %ld\n", cnt_nodes, list->size_data);
+        return LIST_RECALLOC_ERR;
+    }
+
+    //One free node is always kept as in List_resize
+    while (new_capacity < list->size_data + cnt_nodes + 1)
+        new_capacity = List_next_capacity (list, new_capacity);
+
+    if (new_capacity == list->capacity) return 0;
+
+    return List_recalloc (list, new_capacity);
+}
+
+//======================================================================================
+
+static int List_recalloc (List *list, const long new_capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (new_capacity == 0) return 0;
+
+    if (new_capacity <= list->size_data || new_capacity > Max_list_capacity)
+    {
+        Log_report ("The list is not subject to recalloc, new_capacity = %ld\n", new_capacity);
+        Err_report ();
+        return LIST_RECALLOC_ERR;
+    }
+
+    //The bitmap grows before the nodes and shrinks after them, so it always covers the capacity
+    if (new_capacity > list->capacity && List_occupancy_realloc (list, new_capacity))
+    {
+        Log_report ("Occupancy bitmap is nullptr after use recalloc\n");
+        Err_report ();
+        return ERR_MEMORY_ALLOC;
+    }
+
+    if (list->handles != nullptr && List_handles_resize (list->handles, new_capacity))
+    {
+        Log_report ("Handle arrays are nullptr after use recalloc\n");
+        Err_report ();
+        return ERR_MEMORY_ALLOC;
+    }
+
+    if (List_data_realloc (list, new_capacity))
+    {
+        Log_report ("List data is nullptr after use recalloc\n");
+        Err_report ();
+        return ERR_MEMORY_ALLOC;
+    }
+
+    if (new_capacity < list->capacity)
+        List_occupancy_realloc (list, new_capacity);
+
+    List_dirty_mark_all (list);
+
+    if (list->index != nullptr && List_index_resize (list->index, new_capacity))
+        List_index_invalidate (list);
+
+    long old_capacity = list->capacity;
+
+    list->capacity = new_capacity;
+
+    int init_err = 0;
+
+    if (new_capacity > old_capacity)
+    {
+        //New nodes continue the unused region [bump_ptr, capacity], they are not touched until they are used
+        list->cnt_free_nodes += new_capacity - old_capacity;
+    }
+    else
+    {
+        //Nodes of a linearized list lie in [head_ptr, tail_ptr], the rest are free
+        list->free_ptr       = Identifier_free_node;
+        list->bump_ptr       = list->tail_ptr + 1;
+        list->cnt_free_nodes = new_capacity - list->tail_ptr;
+
+        init_err = Init_list_data (list, 1, list->head_ptr - 1);
+    }
+
+    if (init_err)
+    {
+        Log_report ("List data initialization error\n");
+        Err_report ();
+        return LIST_RECALLOC_ERR;
+    }
+
+    if (Check_list (list))
+    {
+        REPORT ("EXIT\nFROM: List_recalloc\n");
+        return LIST_RECALLOC_ERR;
+    } 
+
+    return 0;
+}
+
+//======================================================================================
+
+static size_t List_array_bytes (const long capacity, const size_t elem_size)
+{
+    size_t size_array = (size_t) (capacity + 1) * elem_size;
+
+    #ifdef __linux__
+
+        //Mappings are measured in whole pages
+        size_t page_size = (size_t) sysconf (_SC_PAGESIZE);
+        size_array = (size_array + page_size - 1) / page_size * page_size;
+
+    #endif
+
+    return size_array;
+}
+
+//======================================================================================
+
+static void List_get_arrays (const List *list, void *arrays[])
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (arrays != nullptr && "arrays is nullptr");
+
+    #ifdef LIST_SOA
+
+        arrays[0] = list->vals;
+        arrays[1] = list->nexts;
+        arrays[2] = list->prevs;
+
+    #else
+
+        arrays[0] = list->data;
+
+    #endif
+
+    return;
+}
+
+//======================================================================================
+
+static void List_set_arrays (List *list, void *arrays[])
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (arrays != nullptr && "arrays is nullptr");
+
+    #ifdef LIST_SOA
+
+        list->vals  = (elem_t*) arrays[0];
+        list->nexts = (link_t*) arrays[1];
+        list->prevs = (link_t*) arrays[2];
+
+    #else
+
+        list->data = (Node*) arrays[0];
+
+    #endif
+
+    return;
+}
+
+//======================================================================================
+
+static int List_data_is_nullptr (const List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    void *arrays[Cnt_node_arrays] = {};
+    List_get_arrays (list, arrays);
+
+    for (int it = 0; it < Cnt_node_arrays; it++)
+        if (Check_nullptr (arrays[it])) return 1;
+
+    return 0;
+}
+
+//======================================================================================
+
+#ifdef __linux__
+
+static void* List_array_map (const long capacity, const size_t elem_size)
+{
+    //Anonymous pages are zero and are not committed until they are touched
+    void *new_array = mmap (nullptr, List_array_bytes (capacity, elem_size), PROT_READ | PROT_WRITE, 
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    return (new_array != MAP_FAILED) ? new_array : nullptr;
+}
+
+//======================================================================================
+
+static int List_arrays_map (void *arrays[], const long capacity)
+{
+    assert (arrays != nullptr && "arrays is nullptr");
+
+    for (int it = 0; it < Cnt_node_arrays; it++)
+    {
+        arrays[it] = List_array_map (capacity, Node_array_elem_sizes[it]);
+
+        if (arrays[it] == nullptr)
+        {
+            for (int ip = 0; ip < it; ip++)
+                munmap (arrays[ip], List_array_bytes (capacity, Node_array_elem_sizes[ip]));
+
+            return ERR_MEMORY_ALLOC;
+        }
+    }
+
+    return 0;
+}
+
+#endif
+
+//======================================================================================
+
+static int List_data_alloc (List *list, const long capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    void *arrays[Cnt_node_arrays] = {};
+
+    list->is_mapped = 0;
+
+    #ifdef __linux__
+
+        if (List_array_bytes (capacity, sizeof (Node)) >= LIST_MMAP_THRESHOLD &&
+            !List_arrays_map (arrays, capacity))
+        {
+            list->is_mapped = 1;
+            List_set_arrays (list, arrays);
+
+            return 0;
+        }
+
+    #endif
+
+    for (int it = 0; it < Cnt_node_arrays; it++)
+    {
+        arrays[it] = calloc (capacity + 1, Node_array_elem_sizes[it]);
+
+        if (Check_nullptr (arrays[it]))
+        {
+            for (int ip = 0; ip < it; ip++)
+                free (arrays[ip]);
+
+            return ERR_MEMORY_ALLOC;
+        }
+    }
+
+    List_set_arrays (list, arrays);
+
+    return 0;
+}
+
+//======================================================================================
+
+static int List_data_realloc (List *list, const long new_capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    void *arrays[Cnt_node_arrays] = {};
+    List_get_arrays (list, arrays);
+
+    #ifdef __linux__
+
+        if (list->is_mapped)
+        {
+            for (int it = 0; it < Cnt_node_arrays; it++)
+            {
+                //Pages are moved by the page table, the nodes are not copied
+                void *new_array = mremap (arrays[it], List_array_bytes (list->capacity, Node_array_elem_sizes[it]),
+                                          List_array_bytes (new_capacity, Node_array_elem_sizes[it]), MREMAP_MAYMOVE);
+
+                if (new_array == MAP_FAILED)
+                {
+                    for (int ip = 0; ip < it; ip++)
+                        arrays[ip] = mremap (arrays[ip], List_array_bytes (new_capacity,   Node_array_elem_sizes[ip]),
+                                             List_array_bytes (list->capacity, Node_array_elem_sizes[ip]), MREMAP_MAYMOVE);
+
+                    List_set_arrays (list, arrays);
+                    return ERR_MEMORY_ALLOC;
+                }
+
+                arrays[it] = new_array;
+            }
+
+            List_set_arrays (list, arrays);
+            return 0;
+        }
+
+        void *new_arrays[Cnt_node_arrays] = {};
+
+        if (List_array_bytes (new_capacity, sizeof (Node)) >= LIST_MMAP_THRESHOLD &&
+            !List_arrays_map (new_arrays, new_capacity))
+        {
+            //The last copy: the arrays move to mappings and grow by mremap later
+            long cnt_copied = (list->capacity < new_capacity) ? list->capacity : new_capacity;
+
+            for (int it = 0; it < Cnt_node_arrays; it++)
+            {
+                memcpy (new_arrays[it], arrays[it], (size_t) (cnt_copied + 1) * Node_array_elem_sizes[it]);
+                free (arrays[it]);
+            }
+
+            list->is_mapped = 1;
+            List_set_arrays (list, new_arrays);
+
+            return 0;
+        }
+
+    #endif
+
+    for (int it = 0; it < Cnt_node_arrays; it++)
+    {
+        void *new_array = realloc (arrays[it], (size_t) (new_capacity + 1) * Node_array_elem_sizes[it]);
+
+        if (Check_nullptr (new_array))
+        {
+            List_set_arrays (list, arrays);
+            return ERR_MEMORY_ALLOC;
+        }
+
+        arrays[it] = new_array;
+    }
+
+    List_set_arrays (list, arrays);
+
+    return 0;
+}
+
+//======================================================================================
+
+static void List_data_free (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    void *arrays[Cnt_node_arrays] = {};
+    List_get_arrays (list, arrays);
+
+    for (int it = 0; it < Cnt_node_arrays; it++)
+    {
+        #ifdef __linux__
+
+            if (list->is_mapped)
+            {
+                munmap (arrays[it], List_array_bytes (list->capacity, Node_array_elem_sizes[it]));
+                continue;
+            }
+
+        #endif
+
+        free (arrays[it]);
+    }
+
+    list->is_mapped = 0;
+
+    return;
+}
+
+//======================================================================================
+
+int List_set_resize_policy (List *list, const List_resize_policy *policy)
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (policy != nullptr && "policy is nullptr");
+
+    if (policy->growth_factor <= 1 || policy->min_capacity <= 0 || policy->shrink_ratio < 0 ||
+        (policy->shrink_ratio > 0 && policy->shrink_ratio <= policy->growth_factor))
+    {
+        Log_report ("Incorrect resize policy: growth_factor = %lg, shrink_ratio = %lg, min_capacity = %ld\n",
+                     policy->growth_factor, policy->shrink_ratio, policy->min_capacity);
+        return LIST_RESIZE_POLICY_ERR;
+    }
+
+    list->resize_policy = *policy;
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_reserve (List *list, const long cnt_nodes)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_reserve, cnt_nodes = %ld\n", cnt_nodes);
+        return LIST_RESIZE_ERR;
+    }
+
+    if (cnt_nodes < 0 || cnt_nodes >= Max_list_capacity)
+    {
+        Log_report ("Incorrect cnt_nodes = %ld\n", cnt_nodes);
+        return LIST_RESIZE_ERR;
+    }
+
+    List_dirty_reset (list);
+
+    //One free node is always kept as in List_resize
+    list->reserved_capacity = cnt_nodes + 1;
+
+    if (list->capacity < list->reserved_capacity && List_recalloc (list, list->reserved_capacity))
+    {
+        Log_report ("Recalloc error, cnt_nodes = %ld\n", cnt_nodes);
+        Err_report ();
+        return LIST_RESIZE_ERR;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_reserve, cnt_nodes = %ld\n", cnt_nodes);
+        return LIST_RESIZE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_shrink_to_fit (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_shrink_to_fit\n");
+        return LIST_RESIZE_ERR;
+    }
+
+    List_dirty_reset    (list);
+    List_dirty_mark_all (list);
+
+    //Nodes must lie in [1, size_data] to cut everything after them
+    if ((list->is_linearized == 0 || list->head_ptr > 1) && List_compact (list))
+    {
+        Log_report ("Linearization error\n");
+        Err_report ();
+        return LIST_RESIZE_ERR;
+    }
+
+    list->reserved_capacity = 0;
+
+    long new_capacity = MAX (list->size_data + 1, list->resize_policy.min_capacity);
+
+    if (new_capacity < list->capacity && List_recalloc (list, new_capacity))
+    {
+        Log_report ("Recalloc error, new_capacity = %ld\n", new_capacity);
+        Err_report ();
+        return LIST_RESIZE_ERR;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_shrink_to_fit\n");
+        return LIST_RESIZE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_linearize (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_linearize\n");
+        return LIST_LINEARIZE_ERR;
+    } 
+
+    if (list->is_linearized == 1) 
+        return 0;
+
+    List_dirty_reset    (list);
+    List_dirty_mark_all (list);
+
+    if (List_compact (list))
+    {
+        Log_report ("Linearization error\n");
+        Err_report ();
+        return LIST_LINEARIZE_ERR;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_linearize\n");
+        return LIST_LINEARIZE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int List_compact (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    //Long lists are ranked by several threads, the serial way is kept if there is no memory for it
+    if (list->size_data >= LIST_PARALLEL_MIN_NODES && Parallel_get_threads () > 1 &&
+        List_compact_parallel (list) == 0)
+        return 0;
+
+    //The i-th node in logical order is swapped into the node i, no second array is used
+    if (List_linearize_run (list, list->size_data, nullptr))
+        return LIST_LINEARIZE_ERR;
+
+    //All free nodes are after the tail now, so they are given to the unused region
+    list->free_ptr       = Identifier_free_node;
+    list->bump_ptr       = (link_t) list->size_data + 1;
+    list->cnt_free_nodes = list->capacity - list->size_data;
+
+    return 0;
+}
+
+//======================================================================================
+
+//Arrays of the parallel list ranking. The live nodes are cut into sublists by rulers: the first
+//live node of every LIST_RANK_RULER_GAP physical nodes and the head. Each ruler walks its sublist
+//and gives the nodes their offsets in it, then the short chain of rulers is ranked serially.
+struct List_rank_job
+{
+    List *list = nullptr;
+
+    long cnt_blocks = 0;                    //<- Blocks of LIST_RANK_RULER_GAP physical nodes
+    long cnt_rulers = 0;                    //<- cnt_blocks and the head
+
+    link_t   *rulers       = nullptr;       //<- Ruler of every block, Dummy_element in a block without live nodes
+    link_t   *ruler_next   = nullptr;       //<- The ruler after the sublist, Dummy_element after the tail
+    long     *ruler_offset = nullptr;       //<- Length of the sublist, then its logical position
+    uint64_t *is_ruler     = nullptr;
+
+    link_t *owners = nullptr;               //<- Ruler number of every node, then handle ids in the new order
+    link_t *ranks  = nullptr;               //<- Offset of every node in its sublist, then its logical position
+    elem_t *vals   = nullptr;               //<- Values in the new order
+};
+
+//======================================================================================
+
+static int List_compact_parallel (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    static_assert (LIST_RANK_RULER_GAP % 64 == 0 && LIST_PARALLEL_CHUNK % LIST_RANK_RULER_GAP == 0,
+                   "Blocks of rulers must cover whole words of the bitmaps");
+
+    List_rank_job job = {};
+
+    job.list       = list;
+    job.cnt_blocks = (list->bump_ptr + LIST_RANK_RULER_GAP - 1) / LIST_RANK_RULER_GAP;
+    job.cnt_rulers = job.cnt_blocks + 1;
+
+    size_t size_nodes = (size_t) list->bump_ptr;
+
+    job.rulers       = (link_t*)   calloc ((size_t) job.cnt_rulers, sizeof (link_t));
+    job.ruler_next   = (link_t*)   calloc ((size_t) job.cnt_rulers, sizeof (link_t));
+    job.ruler_offset = (long*)     calloc ((size_t) job.cnt_rulers, sizeof (long));
+    job.is_ruler     = (uint64_t*) calloc (Occupancy_words (list->bump_ptr), sizeof (uint64_t));
+
+    job.owners = (link_t*) malloc (size_nodes * sizeof (link_t));
+    job.ranks  = (link_t*) malloc (size_nodes * sizeof (link_t));
+    job.vals   = (elem_t*) malloc ((size_t) (list->size_data + 1) * sizeof (elem_t));
+
+    int is_error = Check_nullptr (job.rulers) || Check_nullptr (job.ruler_next) || Check_nullptr (job.ruler_offset) ||
+                   Check_nullptr (job.is_ruler) || Check_nullptr (job.owners) || Check_nullptr (job.ranks) ||
+                   Check_nullptr (job.vals);
+
+    long cnt_node_tasks = (list->bump_ptr + LIST_PARALLEL_CHUNK - 1) / LIST_PARALLEL_CHUNK;
+    long cnt_walk_tasks = (job.cnt_rulers + LIST_PARALLEL_CHUNK / LIST_RANK_RULER_GAP - 1) /
+                                           (LIST_PARALLEL_CHUNK / LIST_RANK_RULER_GAP);
+
+    if (!is_error)
+        is_error = Parallel_run (cnt_node_tasks, List_rank_rulers_task, &job);
+
+    if (!is_error)
+    {
+        //The head may lie in a block after another live node
+        link_t head_ptr = list->head_ptr;
+
+        if (!((job.is_ruler[head_ptr / 64] >> (head_ptr % 64)) & 1))
+        {
+            job.is_ruler[head_ptr / 64] |= (uint64_t) 1 << (head_ptr % 64);
+            job.rulers[job.cnt_blocks] = head_ptr;       //<- The last ruler
+        }
+
+        is_error = Parallel_run (cnt_walk_tasks, List_rank_walk_task, &job);
+    }
+
+    if (!is_error)
+    {
+        long offset = 0;
+
+        for (link_t ruler = list->head_ptr; ruler != Dummy_element; )
+        {
+            link_t ruler_num = job.owners[ruler];
+            long   len       = job.ruler_offset[ruler_num];
+
+            job.ruler_offset[ruler_num] = offset;
+
+            offset += len;
+            ruler   = job.ruler_next[ruler_num];
+        }
+
+        is_error = Parallel_run (cnt_node_tasks, List_rank_offset_task, &job) ||
+                   Parallel_run (cnt_node_tasks, List_rank_gather_task, &job);
+    }
+
+    if (!is_error)
+    {
+        long cnt_live_tasks = (list->size_data + LIST_PARALLEL_CHUNK) / LIST_PARALLEL_CHUNK;
+
+        is_error = Parallel_run (cnt_live_tasks, List_rank_scatter_task, &job);
+    }
+
+    free (job.rulers);
+    free (job.ruler_next);
+    free (job.ruler_offset);
+    free (job.is_ruler);
+    free (job.owners);
+    free (job.ranks);
+    free (job.vals);
+
+    //Errors can come only before the scatter, the list is not changed then
+    if (is_error) return LIST_LINEARIZE_ERR;
+
+    link_t last_ptr = (link_t) list->size_data;
+
+    Node_next (list, Dummy_element) = (list->size_data > 0) ? 1 : Dummy_element;
+    Node_prev (list, Dummy_element) = last_ptr;
+
+    if (last_ptr > Dummy_element)
+    {
+        Node_prev (list, 1)        = Dummy_element;
+        Node_next (list, last_ptr) = Dummy_element;
+    }
+
+    //Live nodes are [1, size_data], the rest up to bump_ptr goes to the unused region
+    memset (list->occupancy, 0, Occupancy_words (list->bump_ptr - 1) * sizeof (uint64_t));
+
+    for (long word = 0; word * 64 <= list->size_data; word++)
+    {
+        long cnt_bits = list->size_data + 1 - word * 64;
+
+        list->occupancy[word] = (cnt_bits >= 64) ? ~(uint64_t) 0 : ((uint64_t) 1 << cnt_bits) - 1;
+    }
+
+    Occupancy_reset (list, Dummy_element);
+
+    list->head_ptr      = (last_ptr > Dummy_element) ? 1 : Dummy_element;
+    list->tail_ptr      = last_ptr;
+    list->linear_prefix = last_ptr;
+    list->is_linearized = 1;
+
+    list->free_ptr       = Identifier_free_node;
+    list->bump_ptr       = last_ptr + 1;
+    list->cnt_free_nodes = list->capacity - list->size_data;
+
+    List_index_invalidate (list);
+
+    return 0;
+}
+
+//======================================================================================
+
+static void List_rank_rulers_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_rank_job *job = (List_rank_job*) arg;
+
+    const long blocks_in_task = LIST_PARALLEL_CHUNK / LIST_RANK_RULER_GAP;
+    const long words_in_block = LIST_RANK_RULER_GAP / 64;
+
+    long last_block = (task_ind + 1) * blocks_in_task;
+    if (last_block > job->cnt_blocks)
+        last_block = job->cnt_blocks;
+
+    //Bits of the nodes after bump_ptr are clear, so whole words are scanned
+    for (long block = task_ind * blocks_in_task; block < last_block; block++)
+    {
+        job->rulers[block] = Dummy_element;
+
+        for (long word = block * words_in_block; word < (block + 1) * words_in_block; word++)
+        {
+            if ((size_t) word >= Occupancy_words (job->list->bump_ptr - 1)) break;
+
+            uint64_t bits = job->list->occupancy[word];
+
+            if (bits == 0) continue;
+
+            link_t ruler = (link_t) (word * 64 + __builtin_ctzll (bits));
+
+            job->rulers[block] = ruler;
+            job->is_ruler[word] |= (uint64_t) 1 << (ruler % 64);
+
+            break;
+        }
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static void List_rank_walk_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_rank_job *job = (List_rank_job*) arg;
+    List *list = job->list;
+
+    const long rulers_in_task = LIST_PARALLEL_CHUNK / LIST_RANK_RULER_GAP;
+
+    long last_ruler = (task_ind + 1) * rulers_in_task;
+    if (last_ruler > job->cnt_rulers)
+        last_ruler = job->cnt_rulers;
+
+    for (long ruler_num = task_ind * rulers_in_task; ruler_num < last_ruler; ruler_num++)
+    {
+        link_t ruler = job->rulers[ruler_num];
+
+        if (ruler == Dummy_element) continue;
+
+        link_t offset  = 0;
+        link_t cur_ptr = ruler;
+
+        do
+        {
+            job->owners[cur_ptr] = (link_t) ruler_num;
+            job->ranks [cur_ptr] = offset++;
+
+            cur_ptr = Node_next (list, cur_ptr);
+        }
+        while (cur_ptr != Dummy_element && !((job->is_ruler[cur_ptr / 64] >> (cur_ptr % 64)) & 1));
+
+        job->ruler_next  [ruler_num] = cur_ptr;
+        job->ruler_offset[ruler_num] = offset;
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static void List_rank_offset_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_rank_job *job = (List_rank_job*) arg;
+
+    link_t first_ptr = (link_t) MAX (1, task_ind * LIST_PARALLEL_CHUNK);
+    long   last_ptr  = (task_ind + 1) * LIST_PARALLEL_CHUNK;
+    if (last_ptr > job->list->bump_ptr)
+        last_ptr = job->list->bump_ptr;
+
+    for (link_t cur_ptr = first_ptr; cur_ptr < last_ptr; cur_ptr++)
+        if (Is_occupied (job->list, cur_ptr))
+            job->ranks[cur_ptr] = (link_t) (job->ruler_offset[job->owners[cur_ptr]] + job->ranks[cur_ptr] + 1);
+
+    return;
+}
+
+//======================================================================================
+
+static void List_rank_gather_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_rank_job *job = (List_rank_job*) arg;
+    List *list = job->list;
+
+    link_t first_ptr = (link_t) MAX (1, task_ind * LIST_PARALLEL_CHUNK);
+    long   last_ptr  = (task_ind + 1) * LIST_PARALLEL_CHUNK;
+    if (last_ptr > list->bump_ptr)
+        last_ptr = list->bump_ptr;
+
+    for (link_t cur_ptr = first_ptr; cur_ptr < last_ptr; cur_ptr++)
+    {
+        if (!Is_occupied (list, cur_ptr)) continue;
+
+        link_t rank = job->ranks[cur_ptr];
+
+        job->vals[rank] = Node_val (list, cur_ptr);
+
+        if (list->handles != nullptr)
+        {
+            link_t id = list->handles->ids[cur_ptr];
+
+            job->owners[rank]       = id;
+            list->handles->nodes[id] = rank;
+        }
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static void List_rank_scatter_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_rank_job *job = (List_rank_job*) arg;
+    List *list = job->list;
+
+    link_t first_ptr = (link_t) MAX (1, task_ind * LIST_PARALLEL_CHUNK);
+    long   last_ptr  = (task_ind + 1) * LIST_PARALLEL_CHUNK;
+    if (last_ptr > list->size_data + 1)
+        last_ptr = list->size_data + 1;
+
+    //The links of the first and the last node are fixed by List_compact_parallel
+    for (link_t cur_ptr = first_ptr; cur_ptr < last_ptr; cur_ptr++)
+    {
+        Init_node (list, cur_ptr, job->vals[cur_ptr], cur_ptr + 1, cur_ptr - 1);
+
+        if (list->handles != nullptr)
+            list->handles->ids[cur_ptr] = job->owners[cur_ptr];
+    }
+
+    return;
+}
+
+//======================================================================================
+
+int List_linearize_step (List *list, const long budget)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_linearize_step, budget = %ld\n", budget);
+        return LIST_LINEARIZE_ERR;
+    } 
+
+    if (budget < 0)
+    {
+        Log_report ("Incorrect budget = %ld\n", budget);
+        return LIST_LINEARIZE_ERR;
+    }
+
+    List_dirty_reset (list);
+
+    if (List_linearize_run (list, budget, nullptr))
+    {
+        Log_report ("Linearization step error, budget = %ld\n", budget);
+        Err_report ();
+        return LIST_LINEARIZE_ERR;
+    }
+
+    if (Check_list_exit (list))
+    {
+        REPORT ("EXIT\nFROM: List_linearize_step, budget = %ld\n", budget);
+        return LIST_LINEARIZE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_set_linearize_budget (List *list, const long budget)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (budget < 0)
+    {
+        Log_report ("Incorrect budget = %ld\n", budget);
+        return LIST_LINEARIZE_ERR;
+    }
+
+    list->linearize_budget = budget;
+
+    return 0;
+}
+
+//======================================================================================
+
+static int List_linearize_run (List *list, const long budget, link_t *tracked_ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (budget <= 0) return 0;
+
+    if (list->is_linearized == 1 && list->head_ptr == 1)
+    {
+        list->linear_prefix = (link_t) list->size_data;
+        return 0;
+    }
+
+    link_t logical_ind = Node_next (list, list->linear_prefix);
+    int  is_moved    = 0;
+
+    for (long it = 0; it < budget && list->linear_prefix < list->size_data; it++)
+    {
+        link_t cur_ind = list->linear_prefix + 1;
+
+        if (logical_ind < cur_ind || logical_ind >= list->bump_ptr || 
+            Is_free_node (list, logical_ind))
+        {
+            Log_report ("Incorrect list traversal, logical_ind = %" LINK_T_SPEC "\n", logical_ind);
+            return LIST_LINEARIZE_ERR;
+        }
+
+        if (logical_ind != cur_ind)
+        {
+            if (tracked_ind != nullptr)
+            {
+                if      (*tracked_ind == logical_ind) *tracked_ind = cur_ind;
+                else if (*tracked_ind == cur_ind)     *tracked_ind = logical_ind;
+            }
+
+            List_move_node (list, cur_ind, logical_ind);
+            is_moved = 1;
+        }
+
+        list->linear_prefix = cur_ind;
+        logical_ind = Node_next (list, cur_ind);
+    }
+
+    list->head_ptr = Node_next (list, Dummy_element);
+    list->tail_ptr = Node_prev (list, Dummy_element);
+
+    if (list->linear_prefix == list->size_data)
+        list->is_linearized = 1;
+    else if (is_moved)
+        list->is_linearized = 0;
+
+    return 0;
+}
+
+//======================================================================================
+
+static void List_move_node (List *list, const link_t to_ind, const link_t from_ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (list->handles != nullptr)
+        List_handles_move (list->handles, to_ind, from_ind, !Is_free_node (list, to_ind));
+
+    if (list->index != nullptr && list->index->is_valid)
+        List_index_move (list->index, to_ind, from_ind, !Is_free_node (list, to_ind));
+
+    if (Is_free_node (list, to_ind))
+    {
+        List_unlink_free_node (list, to_ind);
+
+        Init_node (list, to_ind, Node_val (list, from_ind), Node_next (list, from_ind), Node_prev (list, from_ind));
+
+        List_push_free_node (list, from_ind);
+    }
+    else
+    {
+        elem_t tmp_val  = Node_val  (list, to_ind);
+        link_t tmp_next = Node_next (list, to_ind);
+        link_t tmp_prev = Node_prev (list, to_ind);
+
+        Init_node (list, to_ind,   Node_val (list, from_ind), Node_next (list, from_ind), Node_prev (list, from_ind));
+        Init_node (list, from_ind, tmp_val, tmp_next, tmp_prev);
+
+        //Neighbouring nodes point to themselves after the swap
+        if (Node_next (list, to_ind)   == to_ind)   Node_next (list, to_ind)   = from_ind;
+        if (Node_prev (list, to_ind)   == to_ind)   Node_prev (list, to_ind)   = from_ind;
+
+        if (Node_next (list, from_ind) == from_ind) Node_next (list, from_ind) = to_ind;
+        if (Node_prev (list, from_ind) == from_ind) Node_prev (list, from_ind) = to_ind;
+
+        Node_next (list, Node_prev (list, from_ind)) = from_ind;
+        Node_prev (list, Node_next (list, from_ind)) = from_ind;
+
+        List_dirty_mark (list, Node_prev (list, from_ind));
+        List_dirty_mark (list, Node_next (list, from_ind));
+    }
+
+    Node_next (list, Node_prev (list, to_ind)) = to_ind;
+    Node_prev (list, Node_next (list, to_ind)) = to_ind;
+
+    List_dirty_mark (list, to_ind);
+    List_dirty_mark (list, from_ind);
+    List_dirty_mark (list, Node_prev (list, to_ind));
+    List_dirty_mark (list, Node_next (list, to_ind));
+    List_dirty_mark (list, list->free_ptr);
+
+    return;
+}
+
+//======================================================================================
+
+static void List_prefix_cut (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    //Nodes after ind are moved or shifted in logical order
+    if (ind < list->linear_prefix)
+        list->linear_prefix = ind;
+
+    return;
+}
+
+//======================================================================================
+
+link_t Get_ind_by_logical_order (const List *list, const long ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Get_ind_by_logical_order, ind = %ld\n", ind);
+        return GET_LOGICAL_PTR_ERR;
+    }   
+
+    if (ind < 1 || ind > list->size_data)
+    {
+        Log_report ("Number of elements of the requested index.\nind = %ld\n", ind);
+        return GET_LOGICAL_PTR_ERR;
+    }
+
+
+    if (ind <= list->linear_prefix)
+    {
+        return (link_t) ind;
+    }
+
+    else if (list->is_linearized)
+    {
+        return (link_t) (list->head_ptr + ind - 1);
+    }
+
+    else if (list->index != nullptr)
+    {
+        if (!list->index->is_valid && List_index_build (list->index, list))
+        {
+            Log_report ("Index build error\n");
+            return GET_LOGICAL_PTR_ERR;
+        }
+
+        return List_index_select (list->index, ind);
+    }
+
+    else
+    {   
+        link_t logical_ind = list->head_ptr;
+        long counter = 1;
+
+        while (counter < ind)
+        {
+           logical_ind = Node_next (list, logical_ind);
+            counter++;            
+        }
+        
+        return logical_ind;
+    }
+
+    //No list re-validation as list items don't change
+    
+} 
+
+//======================================================================================
+
+long List_get_logical_order (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_get_logical_order, ind = %" LINK_T_SPEC "\n", ind);
+        return GET_LOGICAL_PTR_ERR;
+    }   
+
+    if (!Check_correct_ind (list, ind) || Is_free_node (list, ind))
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return GET_LOGICAL_PTR_ERR;
+    }
+
+    if (ind <= list->linear_prefix)
+        return ind;
+
+    if (list->is_linearized)
+        return ind - list->head_ptr + 1;
+
+    if (list->index != nullptr)
+    {
+        if (!list->index->is_valid && List_index_build (list->index, list))
+        {
+            Log_report ("Index build error\n");
+            return GET_LOGICAL_PTR_ERR;
+        }
+
+        return List_index_rank (list->index, ind);
+    }
+
+    long counter = 1;
+
+    for (link_t logical_ind = Node_prev (list, ind); logical_ind != Dummy_element; 
+             logical_ind = Node_prev (list, logical_ind))
+        counter++;
+
+    return counter;
+}
+
+//======================================================================================
+
+int List_enable_index (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_enable_index\n");
+        return LIST_INDEX_ERR;
+    }   
+
+    if (list->index != nullptr) return 0;
+
+    list->index = (List_index*) calloc (1, sizeof (List_index));
+
+    if (Check_nullptr (list->index))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+        return LIST_INDEX_ERR;
+    }
+
+    if (List_index_ctor  (list->index, list->capacity) || 
+        List_index_build (list->index, list))
+    {
+        Log_report ("Index initialization error\n");
+        Err_report ();
+
+        List_disable_index (list);
+        return LIST_INDEX_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_disable_index (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (list->index == nullptr) return 0;
+
+    List_index_dtor (list->index);
+    free (list->index);
+
+    list->index = nullptr;
+
+    return 0;
+}
+
+//======================================================================================
+
+link_t List_find (const List *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_find, val = %d\n", val);
+        return LIST_INVALID_ERR;
+    }
+
+    link_t first_ptr = Dummy_element;
+    long   cnt_nodes = 0;
+
+    List_contiguous_run (list, &first_ptr, &cnt_nodes);
+
+    long pos = Elems_find (&Node_val (list, first_ptr), cnt_nodes, Node_val_stride, val);
+
+    if (pos >= 0) return (link_t) (first_ptr + pos);
+
+    link_t cur_ptr = (cnt_nodes > 0) ? Node_next (list, first_ptr + cnt_nodes - 1) : list->head_ptr;
+
+    while (cur_ptr != Dummy_element)
+    {
+        link_t next_ptr = Node_next (list, cur_ptr);
+        List_prefetch_node (list, next_ptr);
+
+        if (Node_val (list, cur_ptr) == val) return cur_ptr;
+
+        cur_ptr = next_ptr;
+    }
+
+    return Dummy_element;
+}
+
+//======================================================================================
+
+link_t List_find_if (const List *list, Elem_pred_t pred, void *arg)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_find_if\n");
+        return LIST_INVALID_ERR;
+    }
+
+    if (Check_nullptr ((void*) pred))
+    {
+        Log_report ("Predicate is nullptr\n");
+        return LIST_INVALID_ERR;
+    }
+
+    link_t first_ptr = Dummy_element;
+    long   cnt_nodes = 0;
+
+    List_contiguous_run (list, &first_ptr, &cnt_nodes);
+
+    for (link_t cur_ptr = first_ptr; cur_ptr < first_ptr + cnt_nodes; cur_ptr++)
+        if (pred (Node_val (list, cur_ptr), arg)) return cur_ptr;
+
+    link_t cur_ptr = (cnt_nodes > 0) ? Node_next (list, first_ptr + cnt_nodes - 1) : list->head_ptr;
+
+    while (cur_ptr != Dummy_element)
+    {
+        link_t next_ptr = Node_next (list, cur_ptr);
+        List_prefetch_node (list, next_ptr);
+
+        if (pred (Node_val (list, cur_ptr), arg)) return cur_ptr;
+
+        cur_ptr = next_ptr;
+    }
+
+    return Dummy_element;
+}
+
+//======================================================================================
+
+long List_count (const List *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_count, val = %d\n", val);
+        return LIST_INVALID_ERR;
+    }
+
+    link_t first_ptr = Dummy_element;
+    long   cnt_nodes = 0;
+
+    List_contiguous_run (list, &first_ptr, &cnt_nodes);
+
+    long cnt_equal = Elems_count (&Node_val (list, first_ptr), cnt_nodes, Node_val_stride, val);
+
+    link_t cur_ptr = (cnt_nodes > 0) ? Node_next (list, first_ptr + cnt_nodes - 1) : list->head_ptr;
+
+    while (cur_ptr != Dummy_element)
+    {
+        link_t next_ptr = Node_next (list, cur_ptr);
+        List_prefetch_node (list, next_ptr);
+
+        cnt_equal += (Node_val (list, cur_ptr) == val);
+
+        cur_ptr = next_ptr;
+    }
+
+    return cnt_equal;
+}
+
+//======================================================================================
+
+//Part of a linearized list given to the tasks of List_parallel_for_each
+struct List_for_each_job
+{
+    List *list = nullptr;
+
+    long cnt_nodes  = 0;
+    long chunk_size = 0;            //<- Nodes of one task
+
+    Elem_func_t func = nullptr;
+    void *arg = nullptr;
+};
+
+//Part of a linearized list given to the tasks of List_parallel_reduce
+struct List_reduce_job
+{
+    const List *list = nullptr;
+
+    long cnt_nodes  = 0;
+    long chunk_size = 0;
+
+    Elem_combine_t combine = nullptr;
+
+    elem_t *partials = nullptr;     //<- Results of the tasks
+};
+
+//======================================================================================
+
+int List_parallel_for_each (List *list, Elem_func_t func, void *arg)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_parallel_for_each\n");
+        return LIST_PARALLEL_ERR;
+    }
+
+    if (Check_nullptr ((void*) func))
+    {
+        Log_report ("Function is nullptr\n");
+        return LIST_PARALLEL_ERR;
+    }
+
+    if (list->is_linearized != 1 || list->size_data < LIST_PARALLEL_MIN_NODES)
+    {
+        for (link_t cur_ptr = list->head_ptr; cur_ptr != Dummy_element; cur_ptr = Node_next (list, cur_ptr))
+            func (&Node_val (list, cur_ptr), arg);
+
+        return 0;
+    }
+
+    List_for_each_job job = {};
+
+    job.list       = list;
+    job.cnt_nodes  = list->size_data;
+    job.chunk_size = LIST_PARALLEL_CHUNK;
+    job.func       = func;
+    job.arg        = arg;
+
+    if (Parallel_run ((job.cnt_nodes + job.chunk_size - 1) / job.chunk_size, List_for_each_task, &job))
+    {
+        Log_report ("Parallel run error\n");
+        Err_report ();
+        return LIST_PARALLEL_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_parallel_reduce (const List *list, Elem_combine_t combine, const elem_t init, elem_t *result, const int is_deterministic)
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (result != nullptr && "result is nullptr");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_parallel_reduce\n");
+        return LIST_PARALLEL_ERR;
+    }
+
+    if (Check_nullptr ((void*) combine))
+    {
+        Log_report ("Combiner is nullptr\n");
+        return LIST_PARALLEL_ERR;
+    }
+
+    if (list->is_linearized != 1 || list->size_data < LIST_PARALLEL_MIN_NODES)
+    {
+        *result = List_reduce_serial (list, combine, init, is_deterministic);
+        return 0;
+    }
+
+    List_reduce_job job = {};
+
+    job.list      = list;
+    job.cnt_nodes = list->size_data;
+    job.combine   = combine;
+
+    //Without the fixed parts each thread gets a few parts for balance
+    long cnt_parts = 4 * (long) Parallel_get_threads ();
+
+    job.chunk_size = (is_deterministic) ? LIST_PARALLEL_CHUNK : (job.cnt_nodes + cnt_parts - 1) / cnt_parts;
+
+    long cnt_tasks = (job.cnt_nodes + job.chunk_size - 1) / job.chunk_size;
+
+    job.partials = (elem_t*) calloc ((size_t) cnt_tasks, sizeof (elem_t));
+
+    if (Check_nullptr (job.partials))
+    {
+        Log_report ("Memory allocation error, cnt_tasks = %ld\n", cnt_tasks);
+        Err_report ();
+        return LIST_PARALLEL_ERR;
+    }
+
+    if (Parallel_run (cnt_tasks, List_reduce_task, &job))
+    {
+        free (job.partials);
+
+        Log_report ("Parallel run error\n");
+        Err_report ();
+        return LIST_PARALLEL_ERR;
+    }
+
+    elem_t total = init;
+
+    for (long task_ind = 0; task_ind < cnt_tasks; task_ind++)
+        total = combine (total, job.partials[task_ind]);
+
+    free (job.partials);
+
+    *result = total;
+
+    return 0;
+}
+
+//======================================================================================
+
+static elem_t List_reduce_serial (const List *list, Elem_combine_t combine, const elem_t init, const int is_deterministic)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (!is_deterministic)
+    {
+        elem_t total = init;
+
+        for (link_t cur_ptr = list->head_ptr; cur_ptr != Dummy_element; cur_ptr = Node_next (list, cur_ptr))
+            total = combine (total, Node_val (list, cur_ptr));
+
+        return total;
+    }
+
+    //The same parts as in the parallel reduction, so the result does not depend on the way it is found
+    elem_t total   = init;
+    elem_t partial = 0;
+    long   cnt_in_part = 0;
+
+    for (link_t cur_ptr = list->head_ptr; cur_ptr != Dummy_element; cur_ptr = Node_next (list, cur_ptr))
+    {
+        partial = (cnt_in_part == 0) ? Node_val (list, cur_ptr) : combine (partial, Node_val (list, cur_ptr));
+
+        if (++cnt_in_part == LIST_PARALLEL_CHUNK)
+        {
+            total = combine (total, partial);
+            cnt_in_part = 0;
+        }
+    }
+
+    if (cnt_in_part > 0)
+        total = combine (total, partial);
+
+    return total;
+}
+
+//======================================================================================
+
+static void List_for_each_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_for_each_job *job = (List_for_each_job*) arg;
+
+    link_t first_ptr = (link_t) (job->list->head_ptr + task_ind * job->chunk_size);
+    link_t last_ptr  = job->list->tail_ptr;
+
+    if (first_ptr + job->chunk_size - 1 < last_ptr)
+        last_ptr = (link_t) (first_ptr + job->chunk_size - 1);
+
+    for (link_t cur_ptr = first_ptr; cur_ptr <= last_ptr; cur_ptr++)
+        job->func (&Node_val (job->list, cur_ptr), job->arg);
+
+    return;
+}
+
+//======================================================================================
+
+static void List_reduce_task (const long task_ind, void *arg)
+{
+    assert (arg != nullptr && "arg is nullptr");
+
+    List_reduce_job *job = (List_reduce_job*) arg;
+
+    link_t first_ptr = (link_t) (job->list->head_ptr + task_ind * job->chunk_size);
+    link_t last_ptr  = job->list->tail_ptr;
+
+    if (first_ptr + job->chunk_size - 1 < last_ptr)
+        last_ptr = (link_t) (first_ptr + job->chunk_size - 1);
+
+    elem_t partial = Node_val (job->list, first_ptr);
+
+    for (link_t cur_ptr = first_ptr + 1; cur_ptr <= last_ptr; cur_ptr++)
+        partial = job->combine (partial, Node_val (job->list, cur_ptr));
+
+    job->partials[task_ind] = partial;
+
+    return;
+}
+
+//======================================================================================
+
+elem_t List_combine_sum (const elem_t first, const elem_t second)
+{
+    return first + second;
+}
+
+//======================================================================================
+
+elem_t List_combine_min (const elem_t first, const elem_t second)
+{
+    return (second < first) ? second : first;
+}
+
+//======================================================================================
+
+elem_t List_combine_max (const elem_t first, const elem_t second)
+{
+    return (first < second) ? second : first;
+}
+
+//======================================================================================
+
+static void List_contiguous_run (const List *list, link_t *first_ptr, long *cnt_nodes)
+{
+    assert (list      != nullptr && "list is nullptr\n");
+    assert (first_ptr != nullptr && "first_ptr is nullptr\n");
+    assert (cnt_nodes != nullptr && "cnt_nodes is nullptr\n");
+
+    //The first nodes in logical order that lie one after another in memory
+    if (list->is_linearized == 1 && list->size_data > 0)
+    {
+        *first_ptr = list->head_ptr;
+        *cnt_nodes = list->size_data;
+    }
+    else
+    {
+        *first_ptr = 1;
+        *cnt_nodes = list->linear_prefix;
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static inline void List_prefetch_node (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    //The next node is requested while the current one is compared
+    __builtin_prefetch (&Node_val (list, ind));
+
+    #ifdef LIST_SOA
+
+        __builtin_prefetch (&Node_next (list, ind));
+
+    #endif
+
+    return;
+}
+
+//======================================================================================
+
+int List_enable_handles (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_enable_handles\n");
+        return LIST_HANDLE_ERR;
+    }   
+
+    if (list->handles != nullptr) return 0;
+
+    list->handles = (List_handles*) calloc (1, sizeof (List_handles));
+
+    if (Check_nullptr (list->handles))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+        return LIST_HANDLE_ERR;
+    }
+
+    if (List_handles_ctor  (list->handles, list->capacity) || 
+        List_handles_build (list->handles, list))
+    {
+        Log_report ("Handles initialization error\n");
+        Err_report ();
+
+        List_disable_handles (list);
+        return LIST_HANDLE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_disable_handles (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (list->handles == nullptr) return 0;
+
+    List_handles_dtor (list->handles);
+    free (list->handles);
+
+    list->handles = nullptr;
+
+    return 0;
+}
+
+//======================================================================================
+
+List_handle List_get_handle (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    if (Check_list (list))
+    {
+        REPORT ("ENTRY\nFROM: List_get_handle, ind = %" LINK_T_SPEC "\n", ind);
+        return List_handle {};
+    }
+
+    if (list->handles == nullptr)
+    {
+        Log_report ("Handles are not enabled\n");
+        return List_handle {};
+    }
+
+    if (!Check_correct_ind (list, ind))
+    {
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return List_handle {};
+    }
+
+    link_t id = list->handles->ids[ind];
+
+    return List_handle {id, list->handles->generations[id]};
+}
+
+//======================================================================================
+
+link_t List_handle_ind (const List *list, const List_handle handle)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    //The list is not verified, so every access through a handle stays O(1)
+    if (list->handles == nullptr)
+    {
+        Log_report ("Handles are not enabled\n");
+        return LIST_HANDLE_ERR;
+    }
+
+    link_t ind = List_handles_find (list->handles, handle);
+
+    if (ind == Dummy_element)
+    {
+        Log_report ("Stale handle: id = %" LINK_T_SPEC ", generation = %u\n", handle.id, handle.generation);
+        return LIST_HANDLE_ERR;
+    }
+
+    return ind;
+}
+
+//======================================================================================
+
+elem_t List_handle_get_val (const List *list, const List_handle handle)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    link_t ind = List_handle_ind (list, handle);
+
+    if (ind < 0) return Poison_val;
+
+    return Node_val (list, ind);
+}
+
+//======================================================================================
+
+static void List_handles_on_insert (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
 
-        logical_ind = list->data[logical_ind].next;
+    if (list->handles != nullptr)
+        List_handles_attach (list->handles, ind);
 
-        if (logical_ind != 0 && !Check_correct_ind (list, logical_ind))
-        {
-            Log_report ("Incorrect list traversal, logical_ind = %d\n", logical_ind);
-            Err_report ();
-            return LIST_LINEARIZE_ERR;
-        }
-    }
+    return;
+}
 
-    Init_node (new_data + counter, 
-               list->data[logical_ind].val, Dummy_element, counter - 1);
+//======================================================================================
 
+static void List_handles_on_erase (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
 
-    free (list->data);
+    if (list->handles != nullptr)
+        List_handles_detach (list->handles, ind);
 
-    list->cnt_free_nodes = 0;
+    return;
+}
 
-    list->data = new_data;
-    list->head_ptr = list->data[Dummy_element].next;
-    list->tail_ptr = list->data[Dummy_element].prev;
+//======================================================================================
 
-    if (Init_list_data (list))
-    {
-        Log_report ("List data initialization error\n");
-        Err_report ();
-        return LIST_LINEARIZE_ERR;
-    }
+static void List_index_on_insert (List *list, const link_t prev_ptr, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr\n");
 
-    list->is_linearized = 1;
+    if (list->index == nullptr || !list->index->is_valid) return;
 
-    if (Check_list (list))
-    {
-        REPORT ("EXIT\nFROM: List_linearize\n");
-        return LIST_LINEARIZE_ERR;
-    }
+    if (List_index_insert_after (list->index, prev_ptr, ind))
+        List_index_invalidate (list);
 
-    return 0;;
+    return;
 }
 
 //======================================================================================
 
-int Get_ind_by_logical_order (const List *list, const int ind)
+static void List_index_on_erase (List *list, const link_t ind)
 {
     assert (list != nullptr && "list is nullptr\n");
 
-    if (Check_list (list))
-    {
-        REPORT ("ENTRY\nFROM: Get_ind_by_logical_order, ind = %d\n", ind);
-        return GET_LOGICAL_PTR_ERR;
-    }   
-
-    if (!Check_correct_ind (list, ind) && 
-         list->data[ind].prev != Identifier_free_node)
-    {
-        Log_report ("Incorrect ind = %d\n", ind);
-        return GET_LOGICAL_PTR_ERR;
-    }
+    if (list->index == nullptr || !list->index->is_valid) return;
 
-    if (ind > list->size_data)
-    {
-        Log_report ("Number of elements of the requested index.\nind = %d\n", ind);
-        return GET_LOGICAL_PTR_ERR;
-    }
+    if (List_index_erase (list->index, ind))
+        List_index_invalidate (list);
 
+    return;
+}
 
-    if (list->is_linearized)
-    {
-        return list->head_ptr + ind - 1;
-    }
+//======================================================================================
 
-    else
-    {   
-        int logical_ind = list->head_ptr;
-        int counter = 1;
+static void List_index_invalidate (List *list)
+{
+    assert (list != nullptr && "list is nullptr\n");
 
-        while (counter < ind)
-        {
-           logical_ind = list->data[logical_ind].next;
-            counter++;            
-        }
-        
-        return logical_ind;
-    }
+    if (list->index != nullptr)
+        list->index->is_valid = 0;      //<- Rebuilt by the next lookup
 
-    //No list re-validation as list items don't change
-    
-} 
+    return;
+}
 
 //======================================================================================
 
-int List_get_val (const List *list, const int ind)
+elem_t List_get_val (const List *list, const link_t ind)
 {
     assert (list != nullptr && "list is nullptr");
 
     if (Check_list (list))
     {
-        REPORT ("ENTRY\nFROM: List_get_val, ind = %d\n", ind);
-        return GET_VAL_ERR; 
+        REPORT ("ENTRY\nFROM: List_get_val, ind = %" LINK_T_SPEC "\n", ind);
+        return Poison_val; 
     }
 
     if (!Check_correct_ind (list, ind))
     {
-        Log_report ("Incorrect ind = %d\n", ind);
-        return GET_VAL_ERR;
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
+        return Poison_val;
     }
 
     //No list re-validation as list items don't change
 
-    return list->data[ind].val;
+    return Node_val (list, ind);
 }
 
 //======================================================================================
 
-int List_change_val (const List *list, const int ind, const elem_t val)
+int List_change_val (const List *list, const link_t ind, const elem_t val)
 {
     assert (list != nullptr && "list is nullptr");
 
     if (Check_list (list))
     {
         REPORT ("ENTRY\nFROM: List_change_val,"
-                       " ind = %d, val = %d\n", ind, val);
+                       " ind = %" LINK_T_SPEC ", val = %d\n", ind, val);
         return Poison_val; 
     } 
 
     if (!Check_correct_ind (list, ind))
     {
-        Log_report ("Incorrect ind = %d\n", ind);
+        Log_report ("Incorrect ind = %" LINK_T_SPEC "\n", ind);
         return Poison_val;
     }
 
-    list->data[ind].val = val;
+    Node_val (list, ind) = val;
 
     if (Check_list (list))
     {
         REPORT ("EXIT\nFROM: List_change_val,"
-                       " ind = %d, val = %d\n", ind, val);
+                       " ind = %" LINK_T_SPEC ", val = %d\n", ind, val);
         return Poison_val; 
     }
 
@@ -672,23 +3536,81 @@ int List_change_val (const List *list, const int ind, const elem_t val)
 
 //======================================================================================
 
-static int Check_correct_ind (const List *list, const int ind)
+int List_is_live (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    //The list is not verified, so the check stays O(1)
+    if (ind <= Dummy_element || ind >= list->bump_ptr) return 0;
+
+    return Is_occupied (list, ind);
+}
+
+//======================================================================================
+
+long List_count_live (const List *list, const link_t first_ind, const link_t last_ind)
 {
     assert (list != nullptr && "list is nullptr");
 
     if (Check_list (list))
     {
-        REPORT ("ENTRY\nFROM: Check_correct_ind, ind = %d", ind);
-        return CHECK_IND_ERR; 
+        REPORT ("ENTRY\nFROM: List_count_live,"
+                " first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_INVALID_ERR;
+    }
+
+    if (first_ind <= Dummy_element || last_ind > list->capacity)
+    {
+        Log_report ("Incorrect range: first_ind = %" LINK_T_SPEC ", last_ind = %" LINK_T_SPEC "\n", first_ind, last_ind);
+        return LIST_INVALID_ERR;
+    }
+
+    return Occupancy_count (list, first_ind, last_ind);
+}
+
+//======================================================================================
+
+link_t List_next_live (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long first_ind = (long) ind + 1;
+
+    if (first_ind >= list->bump_ptr) return Dummy_element;
+
+    long word      = first_ind / 64;
+    long last_word = ((long) list->bump_ptr - 1) / 64;      //<- Nodes from bump_ptr are never live
+
+    uint64_t live_bits = list->occupancy[word] & (~(uint64_t) 0 << (first_ind % 64));
+
+    //Empty words of the bitmap are skipped without touching the nodes
+    while (live_bits == 0)
+    {
+        if (++word > last_word) return Dummy_element;
+
+        live_bits = list->occupancy[word];
     }
 
+    return (link_t) (word * 64 + __builtin_ctzll (live_bits));
+}
+
+//======================================================================================
+
+static int Check_correct_ind (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    //The list is verified by the caller
+
     if (ind < 0) return 0;
 
     if (ind == 0) return 0;
 
     if (ind > list->capacity) return 0;
 
-    if (list->data[ind].val == Poison_val) return 0;
+    if (ind >= list->bump_ptr) return 0;
+
+    if (!Is_occupied (list, ind)) return 0;     //<- Any value, Poison_val too, can be kept in the list
     
 
     //No list re-validation as list items don't change
@@ -702,26 +3624,33 @@ static int List_data_not_free_verifier (const List *list)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_nullptr (list->data))
+    if (List_data_is_nullptr (list) || list->occupancy == nullptr)
         return 1;
 
-    int logical_ind = Dummy_element;
-    int counter = 0;
+    link_t logical_ind = Dummy_element;
+    long counter = 0;
         
     while (counter <= list->size_data)
     {
-        if (logical_ind < 0) return 1;
+        if (logical_ind < 0 || logical_ind >= list->bump_ptr) return 1;
 
-        if (list->data[logical_ind].prev == Identifier_free_node) return 1;
+        if (Is_free_node (list, logical_ind)) return 1;
 
-        if (logical_ind != Dummy_element && list->data[logical_ind].val == Poison_val) return 1;
-        
-        logical_ind = list->data[logical_ind].next;
+        if (logical_ind != Dummy_element && !Is_occupied (list, logical_ind)) return 1;
+
+        if (logical_ind != Dummy_element && list->handles != nullptr &&
+            List_handles_node_verify (list->handles, logical_ind)) return 1;
+
+        if (counter >= 1 && counter <= list->linear_prefix && logical_ind != counter) return 1;
+
+        logical_ind = Node_next (list, logical_ind);
         counter++;            
     }
 
     if (logical_ind != Dummy_element) return 1;
 
+    if (Occupancy_count (list, 1, list->bump_ptr - 1) != list->size_data) return 1;
+
     return 0;
 }
 
@@ -731,25 +3660,32 @@ static int List_data_free_verifier (const List *list)
 {
     assert (list != nullptr && "list is nullptr");
 
-    if (Check_nullptr (list->data))
+    if (List_data_is_nullptr (list) || list->occupancy == nullptr)
         return 1;
 
-    int logical_ind = list->free_ptr;
-    int counter = 1;
+    link_t logical_ind   = list->free_ptr;
+    link_t prev_free_ind = Dummy_element;
+    long counter = 1;
+
+    long cnt_unused_nodes = list->capacity - list->bump_ptr + 1;
         
-    while (counter <= list->cnt_free_nodes)
+    while (counter <= list->cnt_free_nodes - cnt_unused_nodes)
     {
-        if (logical_ind < 0) return 1;
+        if (logical_ind < 0 || logical_ind >= list->bump_ptr) return 1;
         
-        if (list->data[logical_ind].prev != Identifier_free_node) return 1;
+        if (Node_prev (list, logical_ind) != Identifier_free_node - prev_free_ind) return 1;
 
-        if (list->data[logical_ind].val != Poison_val) return 1;
+        if (Node_val (list, logical_ind) != Poison_val) return 1;
 
+        if (Is_occupied (list, logical_ind)) return 1;
         
-        logical_ind = list->data[logical_ind].next;
+        prev_free_ind = logical_ind;
+        logical_ind   = Node_next (list, logical_ind);
         counter++;            
     }
 
+    if (logical_ind != Identifier_free_node) return 1;
+
     return 0;
 }
 
@@ -760,7 +3696,9 @@ int List_dump_ (const List *list,
 {
     assert (list != nullptr && "list is nullptr\n");
 
-    uint64_t err = Check_list (list);
+    uint64_t err = List_verify (list, LIST_CHECK_FULL);     //<- Dump always shows the full state
+
+    std::lock_guard<std::mutex> dump_lock (Dump_mutex);
 
     FILE *fp_logs = Get_log_file_ptr ();
 
@@ -805,20 +3743,20 @@ int List_dump_ (const List *list,
     
     #else
 
-        for (int it = 0; it <= list->capacity; it++)
-            fprintf (fp_logs, "%5d", it);
+        for (long it = 0; it <= list->capacity; it++)
+            fprintf (fp_logs, "%5ld", it);
         fprintf (fp_logs, "\n");
         
-        for (int it = 0; it <= list->capacity; it++)
-            fprintf (fp_logs, "%5d", list->data[it].val);
+        for (long it = 0; it <= list->capacity; it++)
+            fprintf (fp_logs, "%5d", Node_val (list, it));
         fprintf (fp_logs, "\n");
         
-        for (int it = 0; it <= list->capacity; it++)
-            fprintf (fp_logs, "%5d", list->data[it].next);
+        for (long it = 0; it <= list->capacity; it++)
+            fprintf (fp_logs, "%5" LINK_T_SPEC, Node_next (list, it));
         fprintf (fp_logs, "\n");
 
-        for (int it = 0; it <= list->capacity; it++)
-            fprintf (fp_logs, "%5d", list->data[it].prev);
+        for (long it = 0; it <= list->capacity; it++)
+            fprintf (fp_logs, "%5" LINK_T_SPEC, Node_prev (list, it));
         fprintf (fp_logs, "\n");
     
     #endif
@@ -841,17 +3779,41 @@ static void Print_list_variables (const List *list, FILE *fpout)
     fprintf (fpout, "<body>\n");
     fprintf (fpout, "<table border=\"1\">\n");
     
-    fprintf (fpout, "<tr><td> data pointer </td> <td> %p </td></tr>", (char*) list->data);
+    #ifdef LIST_SOA
+
+        fprintf (fpout, "<tr><td> vals pointer </td> <td> %p </td></tr>",  (char*) list->vals);
+        fprintf (fpout, "<tr><td> nexts pointer </td> <td> %p </td></tr>", (char*) list->nexts);
+        fprintf (fpout, "<tr><td> prevs pointer </td> <td> %p </td></tr>", (char*) list->prevs);
+
+    #else
+
+        fprintf (fpout, "<tr><td> data pointer </td> <td> %p </td></tr>", (char*) list->data);
+
+    #endif
 
     fprintf (fpout, "<tr><td> size data </td> <td>  %ld </td></tr>",  list->size_data);
     fprintf (fpout, "<tr><td> capacity </td> <td> %ld </td></tr>",    list->capacity);
     fprintf (fpout, "<tr><td>cnt free nodes</td><td> %ld </td></tr>", list->cnt_free_nodes);
 
-    fprintf (fpout, "<tr><td> head pointer </td> <td>  %d </td></tr>",  list->head_ptr);
-    fprintf (fpout, "<tr><td> tail pointer </td> <td>  %d </td></tr>",  list->tail_ptr);
-    fprintf (fpout, "<tr><td> free pointer </td> <td>  %d </td></tr>",  list->free_ptr);
+    fprintf (fpout, "<tr><td> head pointer </td> <td>  %" LINK_T_SPEC " </td></tr>",  list->head_ptr);
+    fprintf (fpout, "<tr><td> tail pointer </td> <td>  %" LINK_T_SPEC " </td></tr>",  list->tail_ptr);
+    fprintf (fpout, "<tr><td> free pointer </td> <td>  %" LINK_T_SPEC " </td></tr>",  list->free_ptr);
+    fprintf (fpout, "<tr><td> bump pointer </td> <td>  %" LINK_T_SPEC " </td></tr>",  list->bump_ptr);
+
+    if (list->occupancy != nullptr && list->bump_ptr > Dummy_element && list->bump_ptr <= list->capacity + 1)
+        fprintf (fpout, "<tr><td> occupied nodes </td> <td>  %ld </td></tr>", Occupancy_count (list, 1, list->bump_ptr - 1));
 
     fprintf (fpout, "<tr><td> is_linearized </td> <td>  %d </td></tr>",  list->is_linearized);
+    fprintf (fpout, "<tr><td> linear prefix </td> <td>  %" LINK_T_SPEC " </td></tr>",  list->linear_prefix);
+    fprintf (fpout, "<tr><td> linearize budget </td> <td>  %ld </td></tr>", list->linearize_budget);
+
+    fprintf (fpout, "<tr><td> cnt operations </td> <td>  %ld </td></tr>", list->cnt_operations);
+    fprintf (fpout, "<tr><td> audit period </td> <td>  %ld </td></tr>",   list->audit_period);
+
+    fprintf (fpout, "<tr><td> growth factor </td> <td>  %lg </td></tr>",    list->resize_policy.growth_factor);
+    fprintf (fpout, "<tr><td> shrink ratio </td> <td>  %lg </td></tr>",     list->resize_policy.shrink_ratio);
+    fprintf (fpout, "<tr><td> min capacity </td> <td>  %ld </td></tr>",     list->resize_policy.min_capacity);
+    fprintf (fpout, "<tr><td> reserved capacity </td> <td>  %ld </td></tr>", list->reserved_capacity);
 
     fprintf (fpout, "</table>\n");
     fprintf (fpout, "</body>\n");
@@ -890,16 +3852,15 @@ static void Print_error_value (uint64_t err, FILE *fpout)
     if (err & INCORRECT_LINEARIZED)
         fprintf (fpout, "Unknown linearize status\n"); 
 
-    #ifdef LIST_DATA_CHECK
+    if (err & DATA_NODE_INCORRECT)
+        fprintf (fpout, "Сorrupted not-free nodes\n"); 
 
-        if (err & DATA_NODE_INCORRECT)
-            fprintf (fpout, "Сorrupted not-free nodes\n"); 
 
+    if (err & DATA_FREE_NODE_INCORRECT)
+        fprintf (fpout, "Сorrupted free nodes\n"); 
 
-        if (err & DATA_FREE_NODE_INCORRECT)
-            fprintf (fpout, "Сorrupted free nodes\n"); 
-    
-    #endif
+    if (err & DIRTY_NODE_INCORRECT)
+        fprintf (fpout, "Сorrupted nodes touched by the last operation\n"); 
 
     fprintf (fpout, "\n\n");
 
@@ -939,38 +3900,38 @@ static int List_draw_logical_graph (const List *list)
 
     fprintf (graph, "}\n");
 
-    fprintf (graph, "node_head -> node%d\n", list->head_ptr);
-    fprintf (graph, "node_tail -> node%d\n", list->tail_ptr);
-    fprintf (graph, "node_free -> node%d\n", list->free_ptr);
+    fprintf (graph, "node_head -> node%" LINK_T_SPEC "\n", list->head_ptr);
+    fprintf (graph, "node_tail -> node%" LINK_T_SPEC "\n", list->tail_ptr);
+    fprintf (graph, "node_free -> node%" LINK_T_SPEC "\n", list->free_ptr);
 
 
 
-    static int Cnt_graphs = 0;      //<-To display the current list view
+    static int Cnt_graphs = 0;      //<-To display the current list view, guarded by Dump_mutex
 
     fprintf (graph, "{rank =  same;\n");
 
-    for (int counter = 0; counter <= list->capacity; counter++) 
+    for (link_t counter = 0; counter <= list->capacity; counter++) 
     {
-        int next = list->data[counter].next;
-        int prev = list->data[counter].prev;
+        link_t next = Node_next (list, counter);
+        link_t prev = Node_prev (list, counter);
 
-        fprintf (graph, "node%d [style=filled, shape = record, label =  \"{NODE %d | VAL: %d| prev: %d | next: %d}}\",", 
-                        counter, counter, list->data[counter].val, prev, next);
+        fprintf (graph, "node%" LINK_T_SPEC " [style=filled, shape = record, label =  \"{NODE %" LINK_T_SPEC " | VAL: %d| prev: %" LINK_T_SPEC " | next: %" LINK_T_SPEC "}}\",", 
+                        counter, counter, Node_val (list, counter), prev, next);
 
-        if (prev != -1)
+        if (prev > Identifier_free_node)
             fprintf (graph, " fillcolor=lightpink ];\n");
         else
             fprintf (graph, " fillcolor=lightskyblue ];\n");
 
         if (next != -1)
         {
-            fprintf (graph, "node%d -> node%d[style=filled, fillcolor=yellow];\n", 
+            fprintf (graph, "node%" LINK_T_SPEC " -> node%" LINK_T_SPEC "[style=filled, fillcolor=yellow];\n", 
                              counter, next);
         }
 
-        if (prev != -1)
+        if (prev > Identifier_free_node)
         {
-            fprintf (graph, "node%d -> node%d[style=filled, fillcolor=green];\n", 
+            fprintf (graph, "node%" LINK_T_SPEC " -> node%" LINK_T_SPEC "[style=filled, fillcolor=green];\n", 
                              counter, prev);
         }
 
@@ -1036,38 +3997,38 @@ static int List_draw_physical_graph (const List *list)
 
     fprintf (graph, "}\n");
 
-    fprintf (graph, "node_head -> node%d\n", list->head_ptr);
-    fprintf (graph, "node_tail -> node%d\n", list->tail_ptr);
-    fprintf (graph, "node_free -> node%d\n", list->free_ptr);
+    fprintf (graph, "node_head -> node%" LINK_T_SPEC "\n", list->head_ptr);
+    fprintf (graph, "node_tail -> node%" LINK_T_SPEC "\n", list->tail_ptr);
+    fprintf (graph, "node_free -> node%" LINK_T_SPEC "\n", list->free_ptr);
 
 
 
-    static int Cnt_graphs = 0;      //<-To display the current list view
+    static int Cnt_graphs = 0;      //<-To display the current list view, guarded by Dump_mutex
 
     fprintf (graph, "{rank =  same;\n");
 
-    for (int counter = 0; counter <= list->capacity; counter++) 
+    for (link_t counter = 0; counter <= list->capacity; counter++) 
     {
-        int next = list->data[counter].next;
-        int prev = list->data[counter].prev;
+        link_t next = Node_next (list, counter);
+        link_t prev = Node_prev (list, counter);
 
-        fprintf (graph, "node%d [style=filled, shape = record, label =  \"{NODE %d | VAL: %d| prev: %d | next: %d}}\",", 
-                        counter, counter, list->data[counter].val, prev, next);
+        fprintf (graph, "node%" LINK_T_SPEC " [style=filled, shape = record, label =  \"{NODE %" LINK_T_SPEC " | VAL: %d| prev: %" LINK_T_SPEC " | next: %" LINK_T_SPEC "}}\",", 
+                        counter, counter, Node_val (list, counter), prev, next);
 
-        if (prev != -1)
+        if (prev > Identifier_free_node)
             fprintf (graph, " fillcolor=lightpink ];\n");
         else
             fprintf (graph, " fillcolor=lightskyblue ];\n");
 
         if (next != -1)
         {
-            fprintf (graph, "node%d -> node%d[style=filled, fillcolor=yellow, weight = 0];\n", 
+            fprintf (graph, "node%" LINK_T_SPEC " -> node%" LINK_T_SPEC "[style=filled, fillcolor=yellow, weight = 0];\n", 
                              counter, next);
         }
 
-        if (prev != -1)
+        if (prev > Identifier_free_node)
         {
-            fprintf (graph, "node%d -> node%d[style=filled, fillcolor=green, weight = 0];\n", 
+            fprintf (graph, "node%" LINK_T_SPEC " -> node%" LINK_T_SPEC "[style=filled, fillcolor=green, weight = 0];\n", 
                              counter, prev);
         }
 
@@ -1075,7 +4036,7 @@ static int List_draw_physical_graph (const List *list)
     
         if (counter != list->capacity)
         {
-              fprintf (graph, "node%d -> node%d[style = invis, weight = 10000];\n", 
+              fprintf (graph, "node%" LINK_T_SPEC " -> node%" LINK_T_SPEC "[style = invis, weight = 10000];\n", 
                              counter, counter + 1);
         }
 
@@ -1110,43 +4071,249 @@ static int List_draw_physical_graph (const List *list)
 
 //======================================================================================
 
-static uint64_t Check_list (const List *list)
+static uint64_t List_verify (const List *list, const int check_level)
 {
     assert (list != nullptr && "list is nullptr");
 
     uint64_t err = 0;
 
+    if (check_level == LIST_CHECK_OFF) return 0;
+
     if (list->size_data < 0) err |= NEGATIVE_SIZE;
     if (list->capacity  < 0) err |= NEGATIVE_CAPAITY;
 
 
     if (list->capacity  < list->size_data)    err |= CAPACITY_LOWER_SIZE;
 
-    if (Check_nullptr (list->data))           err |= DATA_IS_NULLPTR;
+    if (List_data_is_nullptr (list) || list->occupancy == nullptr) err |= DATA_IS_NULLPTR;
 
     if (list->head_ptr == Poison_ptr                     ||
         list->head_ptr < 0                               ||  
-        list->data[list->tail_ptr].next != Dummy_element   ) err |= ILLIQUID_HEAD_PTR;
+        Node_next (list, list->tail_ptr) != Dummy_element   ) err |= ILLIQUID_HEAD_PTR;
 
     if (list->tail_ptr == Poison_ptr                     ||
         list->tail_ptr < 0                               ||  
-        list->data[list->tail_ptr].next != Dummy_element   ) err |= ILLIQUID_TAIL_PTR;
+        Node_next (list, list->tail_ptr) != Dummy_element   ) err |= ILLIQUID_TAIL_PTR;
+
+    if (list->free_ptr <  Identifier_free_node  || 
+        list->free_ptr == Dummy_element         || 
+        list->free_ptr >= list->bump_ptr          ) err |= ILLIQUID_FREE_PTR;
 
-    if (list->free_ptr <  0             || 
-        list->free_ptr > list->capacity ||  
-        list->free_ptr == Poison_ptr      ) err |= ILLIQUID_FREE_PTR;
+    if (list->bump_ptr <= Dummy_element         ||
+        list->bump_ptr >  list->capacity + 1      ) err |= ILLIQUID_FREE_PTR;
+
+    if (list->free_ptr == Identifier_free_node &&
+        list->bump_ptr >  list->capacity          ) err |= ILLIQUID_FREE_PTR;    //<- No free nodes
 
     if ((list->is_linearized != 0) && (list->is_linearized != 1)) err |= INCORRECT_LINEARIZED; 
 
-    #ifdef LIST_DATA_CHECK
+    if (list->linear_prefix < 0 || list->linear_prefix > list->size_data) err |= INCORRECT_LINEARIZED;
+
+    if (check_level == LIST_CHECK_DIRTY)
+    {
+        if (List_dirty_verifier (list)) err |= DIRTY_NODE_INCORRECT;
+
+        return err;
+    }
 
+    if (check_level == LIST_CHECK_FULL)
+    {
         if (List_data_not_free_verifier (list))   err |= DATA_NODE_INCORRECT;
 
         if (List_data_free_verifier (list))       err |= DATA_FREE_NODE_INCORRECT;
+    }
+
+    return err;
+}
+
+//======================================================================================
+
+#if LIST_CHECK_LEVEL > 0
+
+static uint64_t List_verify_exit (List *list, const int check_level)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (check_level != LIST_CHECK_DIRTY || !List_is_audit_due (list))
+        return List_verify (list, check_level);
+
+    uint64_t err = List_verify (list, LIST_CHECK_FULL);
+
+    list->cnt_dirty_nodes = 0;      //<- The whole list is checked, the next entry checks have nothing to check
+
+    return err;
+}
+
+//======================================================================================
+
+static int List_is_audit_due (const List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return (list->cnt_dirty_nodes > Max_dirty_nodes) ||
+           (list->audit_period > 0 && list->cnt_operations % list->audit_period == 0);
+}
+
+#endif
+
+//======================================================================================
+
+int List_set_check_level (const int level)
+{
+    if (level < LIST_CHECK_OFF || level > LIST_CHECK_LEVEL)
+    {
+        Log_report ("Incorrect check level = %d, maximum level = %d\n", level, LIST_CHECK_LEVEL);
+        return LIST_CHECK_LEVEL_ERR;
+    }
+
+    Cur_check_level = level;
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_get_check_level ()
+{
+    return Cur_check_level;
+}
+
+//======================================================================================
+
+int List_set_audit_period (List *list, const long period)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (period < 0)
+    {
+        Log_report ("Incorrect audit period = %ld\n", period);
+        return LIST_AUDIT_ERR;
+    }
+
+    list->audit_period = period;
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_audit (const List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (List_verify (list, LIST_CHECK_FULL))
+    {
+        REPORT ("AUDIT\nFROM: List_audit\n");
+        return LIST_AUDIT_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static void List_dirty_reset (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    #if LIST_CHECK_LEVEL >= 2
+
+        list->cnt_dirty_nodes = 0;
+        list->cnt_operations++;
+
+    #endif
+
+    return;
+}
+
+//======================================================================================
+
+static void List_dirty_mark (List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    #if LIST_CHECK_LEVEL >= 2
+
+        if (list->cnt_dirty_nodes < Max_dirty_nodes)
+            list->dirty_nodes[list->cnt_dirty_nodes++] = ind;
+        else
+            list->cnt_dirty_nodes = Max_dirty_nodes + 1;
+
+    #else
+    
+        (void) ind;
     
     #endif
 
-    return err;
+    return;
+}
+
+//======================================================================================
+
+static void List_dirty_mark_all (List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    list->cnt_dirty_nodes = Max_dirty_nodes + 1;
+
+    return;
+}
+
+//======================================================================================
+
+static int List_dirty_verifier (const List *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (List_data_is_nullptr (list) || list->occupancy == nullptr)
+        return 1;
+
+    if (list->cnt_dirty_nodes > Max_dirty_nodes) return 0;     //<- The whole list is checked by the exit audit
+
+    for (int it = 0; it < list->cnt_dirty_nodes; it++)
+    {
+        link_t ind = list->dirty_nodes[it];
+
+        if (ind < 0 || ind > list->capacity) continue;      //<- The node has been cut off by the resize
+
+        if (List_node_verifier (list, ind)) return 1;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int List_node_verifier (const List *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (ind >= list->bump_ptr) return 0;       //<- Unused nodes are not initialized
+
+    elem_t val  = Node_val  (list, ind);
+    link_t next = Node_next (list, ind);
+    link_t prev = Node_prev (list, ind);
+
+    if (ind != Dummy_element && Is_occupied (list, ind) == Is_free_node (list, ind)) return 1;
+
+    if (Is_free_node (list, ind))
+    {
+        if (val != Poison_val) return 1;
+
+        if (next < Identifier_free_node || next > list->capacity) return 1;
+
+        if (Identifier_free_node - prev > list->capacity) return 1;
+
+        return 0;
+    }
+
+    if (next < 0 || next > list->capacity) return 1;
+    if (prev < 0 || prev > list->capacity) return 1;
+
+    if (Node_prev (list, next) != ind) return 1;
+    if (Node_next (list, prev) != ind) return 1;
+
+    return 0;
 }
 
 //======================================================================================
\ No newline at end of file
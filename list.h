@@ -1,20 +1,53 @@
 #ifndef _LIST_H_
 #define _LIST_H_
 
+#include <limits.h>
+
 #include "config_list.h"
+#include "list_codes.h"
 #include "src/log_info/log_def.h"
 
-const int Identifier_free_node = -1;
+const link_t Identifier_free_node = -1;    //<- Free nodes keep Identifier_free_node minus the previous free node in prev
+
+const link_t Dummy_element = 0;
 
-const int Dummy_element = 0;
+const long Max_list_capacity = (Link_max < LONG_MAX) ? (long) Link_max - 1 : LONG_MAX - 1;   //<- bump_ptr up to capacity + 1 fits in link_t
 
 const int Max_command_buffer = 100;
 
+const int Max_dirty_nodes = 8;      //<- More touched nodes per operation lead to a full audit
+
+typedef int (*Elem_cmp_t) (const elem_t first, const elem_t second);    //<- Negative, zero or positive like in qsort
+
+typedef int (*Elem_pred_t) (const elem_t val, void *arg);               //<- Non-zero for the searched values
+
+typedef void (*Elem_func_t) (elem_t *val, void *arg);
+
+typedef elem_t (*Elem_combine_t) (const elem_t first, const elem_t second);     //<- Associative, like List_combine_sum
+
+struct List_index;
+
+struct List_handles;
+
+struct List_handle
+{
+    link_t   id         = 0;        //<- Zero is the empty handle
+    uint32_t generation = 0;
+};
+
+struct List_resize_policy
+{
+    double growth_factor = LIST_GROWTH_FACTOR;      //<- Capacity of a full list is multiplied by it
+    double shrink_ratio  = LIST_SHRINK_RATIO;       //<- Shrink when capacity / shrink_ratio nodes are used, zero - never
+
+    long min_capacity = LIST_MIN_CAPACITY;          //<- The list is not shrunk below it
+};
+
 struct Node
 {
     elem_t val = 0;
-    int next = 0;
-    int prev = 0;
+    link_t next = 0;
+    link_t prev = 0;
 };
 
 struct List
@@ -23,68 +56,61 @@ struct List
     long size_data      = 0; 
     long cnt_free_nodes = 0;
 
-    Node *data = nullptr;
+#ifdef LIST_SOA
 
-    int head_ptr  = 0;
-    int tail_ptr  = 0;
-    int free_ptr  = 0;
+    elem_t *vals  = nullptr;    //<- Fields of the nodes are kept in separate arrays
+    link_t *nexts = nullptr;
+    link_t *prevs = nullptr;
 
-    int is_linearized = 0; 
-};
+#else
 
+    Node *data = nullptr;
 
-enum List_func_err
-{
-    LIST_CTOR_ERR           = -1,
-    LIST_DTOR_ERR           = -2,
+#endif
+
+    int is_mapped = 0;      //<- Node arrays are anonymous mappings grown by mremap, see LIST_MMAP_THRESHOLD
 
-    LIST_INVALID_ERR        = -3,
+    uint64_t *occupancy = nullptr;  //<- Bit i is set when node i holds a value, free nodes are searched in it near their neighbours
 
-    INDEFINITI_PTR_ERR      = -4,
+    link_t head_ptr  = 0;
+    link_t tail_ptr  = 0;
+    link_t free_ptr  = 0;   //<- Top of the stack of recycled nodes
+    link_t bump_ptr  = 0;   //<- Nodes in [bump_ptr, capacity] are free and have not been used since List_ctor or List_clear
 
-    FREE_PTR_IS_DUMMY_ERR   = -5,
+    int    is_linearized = 0; 
+    link_t linear_prefix = 0;                   //<- Node i is the i-th node in logical order for i in [1, linear_prefix]
 
-    PTR_OUT_OF_MEMOY_ERR    = -6,
-    
-    LIST_INSERT_ERR         = -7,
-    LIST_ERASE_ERR          = -8,
+    long linearize_budget = 0;                  //<- Nodes moved to their places by each insert and erase
 
-    DATA_INIT_ERR           = -9,
-    DATA_CLEAR_ERR          = -10,
+    link_t dirty_nodes[Max_dirty_nodes] = {};   //<- Nodes touched by the last operation
+    int    cnt_dirty_nodes = 0;                 //<- Max_dirty_nodes + 1 means that the whole list was touched
 
-    GET_LOGICAL_PTR_ERR     = -11,
-    GET_VAL_ERR             = -12,
+    long cnt_operations = 0;
+    long audit_period   = 0;                    //<- Full audit every audit_period operations, zero - never
 
-    CHECK_IND_ERR           = -13,
+    List_index *index = nullptr;                //<- Optional order-statistics index, see List_enable_index
 
-    LIST_RESIZE_ERR         = -14,    
-    LIST_RECALLOC_ERR       = -15,
+    List_handles *handles = nullptr;            //<- Optional stable handles of the nodes, see List_enable_handles
 
-    LIST_LINEARIZE_ERR      = -16,
-    
-    LIST_DRAW_GRAPH_ERR     = -17,
+    List_resize_policy resize_policy = {};
+    long reserved_capacity = 0;                 //<- Set by List_reserve, the list is not shrunk below it
 };
 
-enum List_err
-{
-    NEGATIVE_SIZE               = (1 << 0),
-    NEGATIVE_CAPAITY            = (1 << 1),
-    CAPACITY_LOWER_SIZE         = (1 << 2),
 
-    ILLIQUID_FREE_PTR           = (1 << 3),
+//Access to the fields of node ind for both layouts of the node arrays
+#ifdef LIST_SOA
 
-    DATA_IS_NULLPTR             = (1 << 4),
+    #define Node_val(list, ind)  ((list)->vals [ind])
+    #define Node_next(list, ind) ((list)->nexts[ind])
+    #define Node_prev(list, ind) ((list)->prevs[ind])
 
-    INCORRECT_LINEARIZED        = (1 << 5),
+#else
 
-    DATA_NODE_INCORRECT         = (1 << 6),
-    DATA_FREE_NODE_INCORRECT    = (1 << 7),
-
-    ILLIQUID_HEAD_PTR           = (1 << 8),
-    ILLIQUID_TAIL_PTR           = (1 << 9),
-    
-};
+    #define Node_val(list, ind)  ((list)->data[ind].val)
+    #define Node_next(list, ind) ((list)->data[ind].next)
+    #define Node_prev(list, ind) ((list)->data[ind].prev)
 
+#endif
 
 
 int List_ctor (List *list, const long capacity);
@@ -100,11 +126,28 @@ int List_dtor (List *list);
  * @param [in] val The value of the added node
  * @return If a vertex has been added, it returns the Physical Pointer where the element is located, otherwise a negative number
 */
-int List_insert_befor_ind (List *list, const int ind, const elem_t val);
+link_t List_insert_befor_ind (List *list, const link_t ind, const elem_t val);
 
-int List_insert_front     (List *list, const elem_t val);
+link_t List_insert_front     (List *list, const elem_t val);
 
-int List_insert_back      (List *list, const elem_t val);
+link_t List_insert_back      (List *list, const elem_t val);
+
+
+/** 
+ * @brief Adds an array of nodes to the list with one resize
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind The index of the memory location before which we want to add new nodes, the same as in List_insert_befor_ind
+ * @param [in] vals Values of the added nodes in their logical order
+ * @param [in] cnt_vals Number of values
+ * @return Returns the physical pointer of the first added node, otherwise a negative number
+ * @note If new nodes take consecutive free nodes right after the tail of a linearized list, it stays linearized
+*/
+link_t List_insert_before_n (List *list, const link_t ind, const elem_t *vals, const long cnt_vals);
+
+link_t List_insert_front_n  (List *list, const elem_t *vals, const long cnt_vals);
+
+link_t List_insert_back_n   (List *list, const elem_t *vals, const long cnt_vals);
 
 
 /** 
@@ -114,10 +157,142 @@ int List_insert_back      (List *list, const elem_t val);
  * @param [in] ind The pointer by which we will delete the node. (The node at the given index must be initialized)
  * @return Returns zero if the node is deleted, otherwise returns a non-zero number
 */
-int List_erase (List *list, const int ind);
+int List_erase (List *list, const link_t ind);
+
+/** 
+ * @brief Removes nodes from first_ind to last_ind in logical order
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] first_ind The pointer of the first removed node
+ * @param [in] last_ind The pointer of the last removed node. (It must be first_ind or follow it)
+ * @return Returns zero if the nodes are deleted, otherwise returns a non-zero number
+ * @note The whole range is returned to the free list as one chain, capacity is not changed.
+ *       It takes O(k) for k erased nodes: the range is walked once to count and check it, and once
+ *       to mark its nodes free in the occupancy bitmap, the index and the handles. Only List_clear marks lazily
+*/
+int List_erase_range (List *list, const link_t first_ind, const link_t last_ind);
 
+/** 
+ * @brief Removes all nodes in O(1), free nodes are marked lazily
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @return Returns zero if the list is cleared, otherwise returns a non-zero number
+*/
+int List_clear (List *list);
 
-int Get_ind_by_logical_order (const List *list, const int ind);
+
+/** 
+ * @brief Moves nodes from first_ind to last_ind of src_list to list
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer, the destination list
+ * @param [in] ind The index of the memory location before which we want to add the nodes, the same as in List_insert_befor_ind
+ * @param [in] *src_list Structure List pointer, the source list. (It can be list itself)
+ * @param [in] first_ind The pointer of the first moved node in src_list
+ * @param [in] last_ind The pointer of the last moved node in src_list. (It must be first_ind or follow it)
+ * @return Returns the physical pointer of the first moved node in list, otherwise a negative number
+ * @note Between different lists values are copied with one resize, inside one list the range is relinked
+*/
+link_t List_splice (List *list, const link_t ind, List *src_list, const link_t first_ind, const link_t last_ind);
+
+/** 
+ * @brief Moves all nodes after the logical position pos to the back of tail_list
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] pos Number of nodes left in list
+ * @param [in] *tail_list Structure List pointer, constructed list that gets the rest
+ * @return Returns zero if the list is split, otherwise returns a non-zero number
+*/
+int List_split (List *list, const long pos, List *tail_list);
+
+/** 
+ * @brief Merges sorted src_list into sorted list, src_list becomes empty
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] *src_list Structure List pointer
+ * @param [in] cmp Comparator of values, nullptr means ascending order
+ * @return Returns zero if the lists are merged, otherwise returns a non-zero number
+ * @note Equal values of list stay before values of src_list
+*/
+int List_merge (List *list, List *src_list, Elem_cmp_t cmp);
+
+/** 
+ * @brief Sorts the list and linearizes it, so Get_ind_by_logical_order works in O(1) after it
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] cmp Comparator of values, nullptr means ascending order
+ * @return Returns zero if the list is sorted, otherwise returns a non-zero number
+ * @note Nodes are relinked by a stable bottom-up merge sort without allocations, handles stay with their values.
+ *       In ascending order integer values of lists without handles and of at least LIST_SORT_RADIX_MIN_NODES
+ *       nodes are sorted by LSD radix sort in place of the linearized nodes, it needs two temporary arrays of values
+*/
+int List_sort (List *list, Elem_cmp_t cmp);
+
+
+/** 
+ * @brief Physical pointer of the node by its logical order
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind Logical order of the node, starting from 1
+ * @return Returns the physical pointer, otherwise a negative number
+ * @note O(1) for a linearized list, O(log n) with the index, otherwise O(n)
+*/
+link_t Get_ind_by_logical_order (const List *list, const long ind);
+
+/** 
+ * @brief Logical order of the node by its physical pointer
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind The physical pointer of the node. (The node at the given index must be initialized)
+ * @return Returns the logical order starting from 1, otherwise a negative number
+ * @note O(1) for a linearized list, O(log n) with the index, otherwise O(n)
+*/
+long List_get_logical_order (const List *list, const link_t ind);
+
+/** 
+ * @brief Creates the order-statistics index of the list
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @return Returns zero if the index is created, otherwise returns a non-zero number
+ * @note Inserts and erases update the index in O(log n). Nodes moved by List_linearize and List_linearize_step
+ *       are relabelled in O(1) per move and the index stays valid. Only relinking operations (splice inside
+ *       the list, the merge sort of List_sort, the parallel compaction) invalidate it, the next lookup rebuilds it in O(n)
+*/
+int List_enable_index  (List *list);
+
+int List_disable_index (List *list);
+
+
+/** 
+ * @brief Creates stable handles of the nodes of the list
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @return Returns zero if the handles are created, otherwise returns a non-zero number
+ * @note Inserts, erases and moves of the nodes update the handles in O(1)
+*/
+int List_enable_handles  (List *list);
+
+int List_disable_handles (List *list);
+
+/** 
+ * @brief Handle of the node, it stays valid until the node is removed
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind The physical pointer of the node, for example returned by List_insert_back
+ * @return Returns the handle, the empty handle if handles are not enabled or the node is not in the list
+ * @note Unlike the physical pointer the handle survives List_recalloc, List_linearize and linearization steps
+*/
+List_handle List_get_handle (const List *list, const link_t ind);
+
+/** 
+ * @brief Physical pointer of the node of the handle, checked in O(1)
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] handle The handle from List_get_handle
+ * @return Returns the physical pointer, otherwise a negative number. (A stale handle, whose node was removed, gives an error)
+*/
+link_t List_handle_ind (const List *list, const List_handle handle);
+
+elem_t List_handle_get_val (const List *list, const List_handle handle);   //<- Poison_val if the handle is stale
 
 
 /**
@@ -126,7 +301,7 @@ int Get_ind_by_logical_order (const List *list, const int ind);
  * @param [in] ind The physical index by which we will get the node. (The node at the given index must be initialized)
  * @return Returns a poison value if an element referencing error has occurred, otherwise the return value is assumed to be the actual value of the node
 */
-int List_get_val    (const List *list, const int ind);
+elem_t List_get_val (const List *list, const link_t ind);
 
 /** 
  * @brief Change value by physical index
@@ -135,10 +310,180 @@ int List_get_val    (const List *list, const int ind);
  * @param [in] ind The pointer by which we will chage the node. (The node at the given index must be initialized)
  * @return Returns zero if the node is change, otherwise returns a non-zero number
 */
-int List_change_val (const List *list, const int ind, const int val);
+int List_change_val (const List *list, const link_t ind, const elem_t val);
+
+/** 
+ * @brief Checks whether the node holds a value of the list
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind The physical index of the node
+ * @return Returns 1 if the node is in the list, otherwise 0
+ * @note O(1) by the occupancy bitmap, the list is not verified and values are not compared with Poison_val
+*/
+int List_is_live (const List *list, const link_t ind);
+
+/** 
+ * @brief Number of nodes holding values among the physical indexes from first_ind to last_ind
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] first_ind The first physical index, starting from 1
+ * @param [in] last_ind The last physical index, up to capacity
+ * @return Returns the number of nodes, otherwise a negative number
+ * @note Counted by popcount over the occupancy bitmap, the nodes are not touched
+*/
+long List_count_live (const List *list, const link_t first_ind, const link_t last_ind);
+
+/** 
+ * @brief The next node holding a value in physical order
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] ind The physical index to start after, Dummy_element gives the first node
+ * @return Returns the physical index of the node, Dummy_element after the last one
+ * @note Nodes are visited in memory order, which suits aggregates independent of the logical order.
+ *       The list is not verified, erasing the returned node does not stop the walk
+*/
+link_t List_next_live (const List *list, const link_t ind);
+
+
+/** 
+ * @brief Physical pointer of the first node in logical order with the value val
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] val The searched value
+ * @return Returns the physical pointer, Dummy_element if there is no such node, otherwise a negative number
+ * @note The linearized part of the list is scanned as an array, by AVX2 or SSE2 for LIST_SOA,
+ *       the rest is walked by links with software prefetch of the next node
+*/
+link_t List_find    (const List *list, const elem_t val);
+
+link_t List_find_if (const List *list, Elem_pred_t pred, void *arg);
+
+long   List_count   (const List *list, const elem_t val);       //<- Number of nodes with the value val, otherwise a negative number
+
+
+/** 
+ * @brief Calls func for the value of every node from several threads
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] func The function, it can change the value. (It is called at the same time for different nodes)
+ * @param [in] *arg Argument of func
+ * @return Returns zero if func is called for all nodes, otherwise returns a non-zero number
+ * @note Only a linearized list of at least LIST_PARALLEL_MIN_NODES nodes is split between threads,
+ *       otherwise the nodes are visited by the calling thread. The order of the calls is not defined
+*/
+int List_parallel_for_each (List *list, Elem_func_t func, void *arg);
 
+/** 
+ * @brief Combines init and the values of all nodes in logical order from several threads
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] combine Associative function, for example List_combine_sum, List_combine_min or List_combine_max
+ * @param [in] init The first value of the result
+ * @param [out] *result The result
+ * @param [in] is_deterministic Non-zero to combine parts of LIST_PARALLEL_CHUNK nodes in a fixed order,
+ *                              so the result does not depend on the number of threads, as needed for floating-point values
+ * @return Returns zero if the result is found, otherwise returns a non-zero number
+ * @note Threads are used on the same conditions as in List_parallel_for_each
+*/
+int List_parallel_reduce (const List *list, Elem_combine_t combine, const elem_t init, elem_t *result, const int is_deterministic);
+
+elem_t List_combine_sum (const elem_t first, const elem_t second);
+
+elem_t List_combine_min (const elem_t first, const elem_t second);
+
+elem_t List_combine_max (const elem_t first, const elem_t second);
+
+/** 
+ * @brief Puts the nodes in logical order to the physical indexes 1..size_data
+ * @version 3.0.0
+ * @param [in] *list Structure List pointer
+ * @note With one thread no second buffer is allocated, nodes are swapped into their places in O(size_data).
+ *       Lists of at least LIST_PARALLEL_MIN_NODES nodes are ranked by the threads of Parallel_run and
+ *       moved through temporary arrays of O(capacity), the in-place way is kept if they can not be allocated
+ * @return Returns zero if the list is linearized, otherwise returns a non-zero number
+*/
 int List_linearize (List *list);
 
+/** 
+ * @brief Sets how the list grows and shrinks
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] *policy growth_factor must be greater than 1, shrink_ratio must be zero or greater than growth_factor,
+ *                     so a shrunk list is not grown back by the next insert
+ * @return Returns zero if the policy is set, otherwise returns a non-zero number
+*/
+int List_set_resize_policy (List *list, const List_resize_policy *policy);
+
+/** 
+ * @brief Grows the list so that cnt_nodes nodes fit without reallocations
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] cnt_nodes Number of nodes, the list is not shrunk below it until List_shrink_to_fit
+ * @return Returns zero if the memory is reserved, otherwise returns a non-zero number
+*/
+int List_reserve (List *list, const long cnt_nodes);
+
+/** 
+ * @brief Linearizes the list and releases all free nodes except one
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @note Physical pointers of the nodes change, the reserve of List_reserve is dropped
+ * @return Returns zero if the list is shrunk, otherwise returns a non-zero number
+*/
+int List_shrink_to_fit (List *list);
+
+/** 
+ * @brief Moves at most budget nodes to their places in logical order, continuing from the linearized prefix
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] budget Maximum number of visited nodes
+ * @note Physical pointers of the moved nodes change. The list becomes linearized when linear_prefix reaches size_data
+ * @return Returns zero if the step is done, otherwise returns a non-zero number
+*/
+int List_linearize_step (List *list, const long budget);
+
+/** 
+ * @brief Sets the number of nodes moved by each List_insert_befor_ind, List_insert_front, List_insert_back and List_erase
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] budget Number of nodes, zero disables the steps
+ * @note With non-zero budget physical pointers stay valid only until the next insert or erase
+ * @return Returns zero if the budget is set, otherwise returns a non-zero number
+*/
+int List_set_linearize_budget (List *list, const long budget);
+
+
+/** 
+ * @brief Sets the verification level used by all List functions
+ * @version 1.0.0
+ * @param [in] level New level from List_check_level. (It can not be higher than LIST_CHECK_LEVEL from config_list.h)
+ * @return Returns zero if the level is set, otherwise returns a non-zero number
+ * @note With LIST_CHECK_LEVEL 0 the checks are not compiled at all
+*/
+int List_set_check_level (const int level);
+
+int List_get_check_level ();
+
+
+/** 
+ * @brief Sets how often the full audit is run with LIST_CHECK_DIRTY level
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @param [in] period Number of operations between full audits, zero disables them
+ * @return Returns zero if the period is set, otherwise returns a non-zero number
+ * @note The audit is run once, by the exit check of the change that is due for it,
+ *       entry checks and read-only functions check only the touched nodes
+*/
+int List_set_audit_period (List *list, const long period);
+
+/** 
+ * @brief Checkpoint: full walk over all nodes regardless of the current check level
+ * @version 1.0.0
+ * @param [in] *list Structure List pointer
+ * @return Returns zero if the list is correct, otherwise returns a non-zero number
+*/
+int List_audit (const List *list);
+
 #define List_dump(list, ...)                       \
         List_dump_ (list, LOG_ARGS, __VA_ARGS__)
 
@@ -0,0 +1,87 @@
+#ifndef _LIST_CODES_H_
+#define _LIST_CODES_H_
+
+//Error codes, verifier error bits and check levels of the List functions.
+//They do not depend on the element type, so list_template.h uses them too.
+
+enum List_func_err
+{
+    LIST_CTOR_ERR           = -1,
+    LIST_DTOR_ERR           = -2,
+
+    LIST_INVALID_ERR        = -3,
+
+    INDEFINITI_PTR_ERR      = -4,
+
+    FREE_PTR_IS_DUMMY_ERR   = -5,
+
+    PTR_OUT_OF_MEMOY_ERR    = -6,
+    
+    LIST_INSERT_ERR         = -7,
+    LIST_ERASE_ERR          = -8,
+
+    DATA_INIT_ERR           = -9,
+    DATA_CLEAR_ERR          = -10,
+
+    GET_LOGICAL_PTR_ERR     = -11,
+    GET_VAL_ERR             = -12,
+
+    CHECK_IND_ERR           = -13,
+
+    LIST_RESIZE_ERR         = -14,    
+    LIST_RECALLOC_ERR       = -15,
+
+    LIST_LINEARIZE_ERR      = -16,
+    
+    LIST_DRAW_GRAPH_ERR     = -17,
+
+    LIST_CHECK_LEVEL_ERR    = -18,
+
+    LIST_AUDIT_ERR          = -19,
+
+    LIST_SPLICE_ERR         = -20,
+    LIST_SPLIT_ERR          = -21,
+    LIST_MERGE_ERR          = -22,
+
+    LIST_INDEX_ERR          = -23,
+
+    LIST_RESIZE_POLICY_ERR  = -24,
+
+    LIST_HANDLE_ERR         = -25,
+
+    LIST_PARALLEL_ERR       = -26,
+
+    LIST_SORT_ERR           = -27,
+};
+
+enum List_err
+{
+    NEGATIVE_SIZE               = (1 << 0),
+    NEGATIVE_CAPAITY            = (1 << 1),
+    CAPACITY_LOWER_SIZE         = (1 << 2),
+
+    ILLIQUID_FREE_PTR           = (1 << 3),
+
+    DATA_IS_NULLPTR             = (1 << 4),
+
+    INCORRECT_LINEARIZED        = (1 << 5),
+
+    DATA_NODE_INCORRECT         = (1 << 6),
+    DATA_FREE_NODE_INCORRECT    = (1 << 7),
+
+    ILLIQUID_HEAD_PTR           = (1 << 8),
+    ILLIQUID_TAIL_PTR           = (1 << 9),
+
+    DIRTY_NODE_INCORRECT        = (1 << 10),
+    
+};
+
+enum List_check_level
+{
+    LIST_CHECK_OFF      = 0,        //<- Lists are not verified
+    LIST_CHECK_HEADER   = 1,        //<- O(1) checks of the List fields only
+    LIST_CHECK_DIRTY    = 2,        //<- Header checks and checks of the nodes touched by the last operation
+    LIST_CHECK_FULL     = 3,        //<- Header checks and full walks over free and not-free nodes
+};
+
+#endif  //#endif _LIST_CODES_H_
@@ -0,0 +1,337 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "list_concurrent.h"
+#include "list_index.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+
+enum Concurrent_op_type
+{
+    OP_INSERT_BACK,
+    OP_INSERT_FRONT,
+    OP_INSERT_BEFORE,
+    OP_ERASE,
+    OP_LINEARIZE,
+};
+
+struct Concurrent_op
+{
+    Concurrent_op_type type = OP_INSERT_BACK;
+
+    link_t ind = Dummy_element;
+    elem_t val = 0;
+
+    long result  = 0;
+    int  is_done = 0;
+
+    Concurrent_op *next = nullptr;
+};
+
+static long Concurrent_list_change (Concurrent_list *clist, Concurrent_op *op);
+
+static long Concurrent_op_apply    (List *list, const Concurrent_op *op);
+
+//======================================================================================
+
+int Concurrent_list_ctor (Concurrent_list *clist, const long capacity)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    if (List_ctor (&clist->list, capacity))
+    {
+        Log_report ("List ctor error, capacity = %ld\n", capacity);
+        Err_report ();
+        return CONCURRENT_LIST_CTOR_ERR;
+    }
+
+    clist->batch_first = nullptr;
+    clist->batch_last  = nullptr;
+    clist->is_applying = 0;
+
+    clist->cnt_batches = 0;
+    clist->cnt_changes = 0;
+
+    return 0;
+}
+
+//======================================================================================
+
+int Concurrent_list_dtor (Concurrent_list *clist)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    if (clist->batch_first != nullptr || clist->is_applying)
+    {
+        Log_report ("Concurrent list is destroyed with queued changes\n");
+        return CONCURRENT_LIST_DTOR_ERR;
+    }
+
+    if (List_dtor (&clist->list))
+    {
+        Log_report ("List dtor error\n");
+        Err_report ();
+        return CONCURRENT_LIST_DTOR_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+link_t Concurrent_list_insert_back (Concurrent_list *clist, const elem_t val)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    Concurrent_op op = {};
+
+    op.type = OP_INSERT_BACK;
+    op.val  = val;
+
+    return (link_t) Concurrent_list_change (clist, &op);
+}
+
+//======================================================================================
+
+link_t Concurrent_list_insert_front (Concurrent_list *clist, const elem_t val)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    Concurrent_op op = {};
+
+    op.type = OP_INSERT_FRONT;
+    op.val  = val;
+
+    return (link_t) Concurrent_list_change (clist, &op);
+}
+
+//======================================================================================
+
+link_t Concurrent_list_insert_befor_ind (Concurrent_list *clist, const link_t ind, const elem_t val)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    Concurrent_op op = {};
+
+    op.type = OP_INSERT_BEFORE;
+    op.ind  = ind;
+    op.val  = val;
+
+    return (link_t) Concurrent_list_change (clist, &op);
+}
+
+//======================================================================================
+
+int Concurrent_list_erase (Concurrent_list *clist, const link_t ind)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    Concurrent_op op = {};
+
+    op.type = OP_ERASE;
+    op.ind  = ind;
+
+    return (int) Concurrent_list_change (clist, &op);
+}
+
+//======================================================================================
+
+int Concurrent_list_linearize (Concurrent_list *clist)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    Concurrent_op op = {};
+
+    op.type = OP_LINEARIZE;
+
+    return (int) Concurrent_list_change (clist, &op);
+}
+
+//======================================================================================
+
+static long Concurrent_list_change (Concurrent_list *clist, Concurrent_op *op)
+{
+    assert (clist != nullptr && "clist is nullptr");
+    assert (op    != nullptr && "op is nullptr");
+
+    std::unique_lock<std::mutex> batch_lock (clist->batch_mutex);
+
+    if (clist->batch_last != nullptr)
+        clist->batch_last->next = op;
+    else
+        clist->batch_first = op;
+
+    clist->batch_last = op;
+
+    while (!op->is_done)
+    {
+        //Another writer applies its batch, op is in the next one
+        if (clist->is_applying)
+        {
+            clist->batch_done.wait (batch_lock);
+            continue;
+        }
+
+        Concurrent_op *batch = clist->batch_first;
+
+        clist->batch_first = nullptr;
+        clist->batch_last  = nullptr;
+        clist->is_applying = 1;
+
+        batch_lock.unlock ();
+
+        {
+            std::unique_lock<std::shared_timed_mutex> write_lock (clist->list_lock);
+
+            for (Concurrent_op *cur_op = batch; cur_op != nullptr; cur_op = cur_op->next)
+                cur_op->result = Concurrent_op_apply (&clist->list, cur_op);
+        }
+
+        batch_lock.lock ();
+
+        //The next change is taken before is_done, after it the waiting writer can leave with its op
+        long cnt_changes = 0;
+
+        for (Concurrent_op *cur_op = batch; cur_op != nullptr; cnt_changes++)
+        {
+            Concurrent_op *next_op = cur_op->next;
+
+            cur_op->is_done = 1;
+            cur_op = next_op;
+        }
+
+        clist->is_applying = 0;
+
+        clist->cnt_batches++;
+        clist->cnt_changes += cnt_changes;
+
+        clist->batch_done.notify_all ();
+    }
+
+    return op->result;
+}
+
+//======================================================================================
+
+static long Concurrent_op_apply (List *list, const Concurrent_op *op)
+{
+    assert (list != nullptr && "list is nullptr");
+    assert (op   != nullptr && "op is nullptr");
+
+    switch (op->type)
+    {
+        case OP_INSERT_BACK:
+            return List_insert_back (list, op->val);
+
+        case OP_INSERT_FRONT:
+            return List_insert_front (list, op->val);
+
+        case OP_INSERT_BEFORE:
+            return List_insert_befor_ind (list, op->ind, op->val);
+
+        case OP_ERASE:
+            return List_erase (list, op->ind);
+
+        case OP_LINEARIZE:
+            return List_linearize (list);
+
+        default:
+            Log_report ("Unknown change type = %d\n", (int) op->type);
+            return CONCURRENT_LIST_CHANGE_ERR;
+    }
+}
+
+//======================================================================================
+
+int Concurrent_list_read (Concurrent_list *clist, List_read_t func, void *arg)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    if (Check_nullptr ((void*) func))
+    {
+        Log_report ("Read function is nullptr\n");
+        return CONCURRENT_LIST_READ_ERR;
+    }
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return func (&clist->list, arg);
+}
+
+//======================================================================================
+
+elem_t Concurrent_list_get_val (Concurrent_list *clist, const link_t ind)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return List_get_val (&clist->list, ind);
+}
+
+//======================================================================================
+
+elem_t Concurrent_list_handle_get_val (Concurrent_list *clist, const List_handle handle)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return List_handle_get_val (&clist->list, handle);
+}
+
+//======================================================================================
+
+link_t Concurrent_list_find (Concurrent_list *clist, const elem_t val)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return List_find (&clist->list, val);
+}
+
+//======================================================================================
+
+long Concurrent_list_count (Concurrent_list *clist, const elem_t val)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return List_count (&clist->list, val);
+}
+
+//======================================================================================
+
+long Concurrent_list_size (Concurrent_list *clist)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+    return clist->list.size_data;
+}
+
+//======================================================================================
+
+link_t Concurrent_list_get_ind (Concurrent_list *clist, const long ind)
+{
+    assert (clist != nullptr && "clist is nullptr");
+
+    {
+        std::shared_lock<std::shared_timed_mutex> read_lock (clist->list_lock);
+
+        if (clist->list.index == nullptr || clist->list.index->is_valid)
+            return Get_ind_by_logical_order (&clist->list, ind);
+    }
+
+    //The lookup rebuilds the index, it is a change of the list
+    std::unique_lock<std::shared_timed_mutex> write_lock (clist->list_lock);
+
+    return Get_ind_by_logical_order (&clist->list, ind);
+}
+
+//======================================================================================
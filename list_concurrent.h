@@ -0,0 +1,90 @@
+#ifndef _LIST_CONCURRENT_H_
+#define _LIST_CONCURRENT_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
+
+#include "list.h"
+
+//List shared between threads. Reads take list_lock in shared mode and run at the same time.
+//Changes are put into a batch: the first writer that finds no other one applying a batch
+//takes list_lock in exclusive mode once and applies all queued changes, the others wait
+//for their results. Changes of one thread are applied in the order of the calls.
+
+struct Concurrent_op;
+
+typedef int (*List_read_t) (const List *list, void *arg);
+
+struct Concurrent_list
+{
+    List list = {};
+
+    std::shared_timed_mutex list_lock;
+
+    std::mutex batch_mutex;                     //<- Guards the queue, is_applying and the counters
+    std::condition_variable batch_done;
+
+    Concurrent_op *batch_first = nullptr;       //<- Queued changes, they live on the stacks of the waiting writers
+    Concurrent_op *batch_last  = nullptr;
+
+    int is_applying = 0;
+
+    long cnt_batches = 0;
+    long cnt_changes = 0;                       //<- cnt_changes / cnt_batches is the mean size of a batch
+};
+
+enum Concurrent_list_func_err
+{
+    CONCURRENT_LIST_CTOR_ERR    = -1,
+    CONCURRENT_LIST_DTOR_ERR    = -2,
+
+    CONCURRENT_LIST_READ_ERR    = -3,
+    CONCURRENT_LIST_CHANGE_ERR  = -4,
+};
+
+
+int Concurrent_list_ctor (Concurrent_list *clist, const long capacity);
+
+int Concurrent_list_dtor (Concurrent_list *clist);      //<- No other thread may use clist at this time
+
+/**
+ * @brief Changes of the list, they return the same values as List_insert_back and the others
+ * @version 1.0.0
+ * @note Physical pointers may be changed by the changes of other threads queued before,
+ *       List_handle keeps the node between them
+*/
+link_t Concurrent_list_insert_back      (Concurrent_list *clist, const elem_t val);
+
+link_t Concurrent_list_insert_front     (Concurrent_list *clist, const elem_t val);
+
+link_t Concurrent_list_insert_befor_ind (Concurrent_list *clist, const link_t ind, const elem_t val);
+
+int    Concurrent_list_erase            (Concurrent_list *clist, const link_t ind);
+
+int    Concurrent_list_linearize        (Concurrent_list *clist);
+
+/**
+ * @brief Calls func for the list under the shared lock
+ * @version 1.0.0
+ * @param [in] *clist Structure Concurrent_list pointer
+ * @param [in] func Function that walks or reads the list, its result is returned.
+ *                  It must not change the list, Get_ind_by_logical_order and List_get_logical_order
+ *                  with a built index are not allowed, Concurrent_list_get_ind is used instead
+ * @param [in] *arg Argument of func
+*/
+int Concurrent_list_read (Concurrent_list *clist, List_read_t func, void *arg);
+
+elem_t Concurrent_list_get_val (Concurrent_list *clist, const link_t ind);
+
+elem_t Concurrent_list_handle_get_val (Concurrent_list *clist, const List_handle handle);
+
+link_t Concurrent_list_find  (Concurrent_list *clist, const elem_t val);
+
+long   Concurrent_list_count (Concurrent_list *clist, const elem_t val);
+
+long   Concurrent_list_size  (Concurrent_list *clist);
+
+link_t Concurrent_list_get_ind (Concurrent_list *clist, const long ind);     //<- Exclusive lock when the index is rebuilt
+
+#endif  //#endif _LIST_CONCURRENT_H_
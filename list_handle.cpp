@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "list_handle.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+//======================================================================================
+
+int List_handles_ctor (List_handles *handles, const long capacity)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    if (capacity <= 0)
+    {
+        Log_report ("Incorrectly entered capacity values: %ld\n", capacity);
+        return HANDLES_CTOR_ERR;
+    }
+
+    handles->capacity = 0;
+
+    if (List_handles_resize (handles, capacity))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+        return HANDLES_CTOR_ERR;
+    }
+
+    List_handles_clear (handles);
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_handles_dtor (List_handles *handles)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    free (handles->nodes);
+    free (handles->ids);
+    free (handles->generations);
+
+    handles->nodes       = nullptr;
+    handles->ids         = nullptr;
+    handles->generations = nullptr;
+
+    handles->capacity = -1;
+    handles->free_id  = Poison_ptr;
+    handles->bump_id  = Poison_ptr;
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_handles_resize (List_handles *handles, const long new_capacity)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    if (new_capacity <= handles->capacity) return 0;
+
+    size_t size_arrays = (size_t) (new_capacity + 1);
+
+    link_t   *new_nodes       = (link_t*)   realloc (handles->nodes,       size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_nodes))       handles->nodes       = new_nodes;
+
+    link_t   *new_ids         = (link_t*)   realloc (handles->ids,         size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_ids))         handles->ids         = new_ids;
+
+    uint32_t *new_generations = (uint32_t*) realloc (handles->generations, size_arrays * sizeof (uint32_t));
+    if (!Check_nullptr (new_generations)) handles->generations = new_generations;
+
+    if (Check_nullptr (new_nodes) || Check_nullptr (new_ids) || Check_nullptr (new_generations))
+    {
+        Log_report ("Handle arrays reallocation error, new_capacity = %ld\n", new_capacity);
+        return HANDLES_RESIZE_ERR;
+    }
+
+    //Generations of new slots start from zero, old slots keep theirs so stale handles stay stale
+    memset (handles->generations + handles->capacity + 1, 0, (size_t) (new_capacity - handles->capacity) * sizeof (uint32_t));
+
+    handles->capacity = new_capacity;
+
+    return 0;
+}
+
+//======================================================================================
+
+void List_handles_clear (List_handles *handles)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    //Taken slots are dropped lazily: a slot is checked against bump_id and gets a new generation when it is taken again
+    handles->free_id = Identifier_free_node;
+    handles->bump_id = 1;
+
+    return;
+}
+
+//======================================================================================
+
+int List_handles_build (List_handles *handles, const List *list)
+{
+    assert (handles != nullptr && "handles is nullptr");
+    assert (list    != nullptr && "list is nullptr");
+
+    if (List_handles_resize (handles, list->capacity))
+        return HANDLES_BUILD_ERR;
+
+    List_handles_clear (handles);
+
+    for (link_t node = list->head_ptr; node != Dummy_element; node = Node_next (list, node))
+        List_handles_attach (handles, node);
+
+    return 0;
+}
+
+//======================================================================================
+
+void List_handles_attach (List_handles *handles, const link_t ind)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    link_t id = handles->free_id;
+
+    if (id != Identifier_free_node)
+        handles->free_id = handles->nodes[id];
+    else
+        id = handles->bump_id++;
+
+    handles->generations[id]++;
+
+    handles->nodes[id] = ind;
+    handles->ids[ind]  = id;
+
+    return;
+}
+
+//======================================================================================
+
+void List_handles_detach (List_handles *handles, const link_t ind)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    link_t id = handles->ids[ind];
+
+    handles->generations[id]++;
+
+    handles->nodes[id] = handles->free_id;
+    handles->free_id   = id;
+
+    return;
+}
+
+//======================================================================================
+
+void List_handles_move (List_handles *handles, const link_t to_ind, const link_t from_ind, const int is_swap)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    link_t from_id = handles->ids[from_ind];
+
+    if (is_swap)
+    {
+        link_t to_id = handles->ids[to_ind];
+
+        handles->ids[from_ind] = to_id;
+        handles->nodes[to_id]  = from_ind;
+    }
+
+    handles->ids[to_ind]    = from_id;
+    handles->nodes[from_id] = to_ind;
+
+    return;
+}
+
+//======================================================================================
+
+link_t List_handles_find (const List_handles *handles, const List_handle handle)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    if (handle.id <= Dummy_element || handle.id >= handles->bump_id) return Dummy_element;
+
+    if (handles->generations[handle.id] != handle.generation) return Dummy_element;
+
+    return handles->nodes[handle.id];
+}
+
+//======================================================================================
+
+int List_handles_node_verify (const List_handles *handles, const link_t ind)
+{
+    assert (handles != nullptr && "handles is nullptr");
+
+    if (ind <= Dummy_element || ind > handles->capacity) return 1;
+
+    link_t id = handles->ids[ind];
+
+    if (id <= Dummy_element || id >= handles->bump_id) return 1;
+
+    return handles->nodes[id] != ind;
+}
+
+//======================================================================================
@@ -0,0 +1,77 @@
+#ifndef _LIST_HANDLE_H_
+#define _LIST_HANDLE_H_
+
+#include <stdint.h>
+
+#include "list.h"
+
+//Slot map of stable handles over the nodes of a List. A handle keeps a slot id and the
+//generation of the slot, the slot keeps the physical pointer of its node and is updated
+//when the node is moved, so handles survive List_recalloc and List_linearize.
+
+struct List_handles
+{
+    link_t   *nodes       = nullptr;    //<- Physical pointer of the node of the slot, the next free slot for free slots
+    link_t   *ids         = nullptr;    //<- Slot of the node, indexed by physical pointers
+    uint32_t *generations = nullptr;    //<- Incremented when the slot is taken and when it is released
+
+    long capacity = 0;
+
+    link_t free_id = 0;                 //<- Top of the stack of released slots, Identifier_free_node if it is empty
+    link_t bump_id = 0;                 //<- Slots from bump_id have not been used since List_handles_clear
+};
+
+
+enum List_handles_func_err
+{
+    HANDLES_CTOR_ERR    = -1,
+    HANDLES_DTOR_ERR    = -2,
+
+    HANDLES_RESIZE_ERR  = -3,
+    HANDLES_BUILD_ERR   = -4,
+};
+
+
+int List_handles_ctor   (List_handles *handles, const long capacity);
+
+int List_handles_dtor   (List_handles *handles);
+
+/**
+ * @brief Grows the arrays, they are never shrunk as taken slots can be above the new capacity
+ * @version 1.0.0
+ * @param [in] *handles Structure List_handles pointer
+ * @param [in] new_capacity Capacity of the list
+ * @return Returns zero if the arrays fit new_capacity nodes, otherwise returns a non-zero number
+*/
+int List_handles_resize (List_handles *handles, const long new_capacity);
+
+void List_handles_clear (List_handles *handles);
+
+/**
+ * @brief Gives slots to all nodes of the list in O(n)
+ * @version 1.0.0
+ * @param [in] *handles Structure List_handles pointer
+ * @param [in] *list Structure List pointer
+ * @return Returns zero if the slots are given, otherwise returns a non-zero number
+*/
+int List_handles_build (List_handles *handles, const List *list);
+
+void List_handles_attach (List_handles *handles, const link_t ind);    //<- Takes a slot for the added node ind
+
+void List_handles_detach (List_handles *handles, const link_t ind);    //<- Releases the slot of the removed node ind
+
+/**
+ * @brief Follows the node moved from from_ind to to_ind
+ * @param [in] is_swap Non-zero if the node of to_ind is moved to from_ind at the same time
+*/
+void List_handles_move (List_handles *handles, const link_t to_ind, const link_t from_ind, const int is_swap);
+
+/**
+ * @brief Physical pointer of the node of the handle
+ * @return Returns the physical pointer, Dummy_element if the handle is empty or stale
+*/
+link_t List_handles_find (const List_handles *handles, const List_handle handle);
+
+int List_handles_node_verify (const List_handles *handles, const link_t ind);
+
+#endif  //#endif _LIST_HANDLE_H_
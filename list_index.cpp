@@ -0,0 +1,498 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdio.h>
+
+#include "list_index.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+
+static uint32_t Index_random (List_index *index);
+
+static void Index_update    (List_index *index, const link_t node);
+
+static void Index_rotate_up (List_index *index, const link_t node);
+
+static void Index_count_subtrees (List_index *index);
+
+static link_t Index_relabel (const link_t node, const link_t to_ind, const link_t from_ind);
+
+//======================================================================================
+
+int List_index_ctor (List_index *index, const long capacity)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    if (capacity <= 0)
+    {
+        Log_report ("Incorrectly entered capacity values: %ld\n", capacity);
+        return INDEX_CTOR_ERR;
+    }
+
+    index->capacity = 0;
+    index->seed     = 2463534242u;
+
+    if (List_index_resize (index, capacity))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+        return INDEX_CTOR_ERR;
+    }
+
+    List_index_clear (index);
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_index_dtor (List_index *index)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    free (index->left);
+    free (index->right);
+    free (index->parent);
+    free (index->cnt_nodes);
+    free (index->priority);
+
+    index->left      = nullptr;
+    index->right     = nullptr;
+    index->parent    = nullptr;
+    index->cnt_nodes = nullptr;
+    index->priority  = nullptr;
+
+    index->capacity = -1;
+    index->root     = Poison_ptr;
+    index->is_valid = 0;
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_index_resize (List_index *index, const long new_capacity)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    size_t size_arrays = (size_t) (new_capacity + 1);
+
+    link_t   *new_left      = (link_t*)   realloc (index->left,      size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_left))      index->left      = new_left;
+
+    link_t   *new_right     = (link_t*)   realloc (index->right,     size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_right))     index->right     = new_right;
+
+    link_t   *new_parent    = (link_t*)   realloc (index->parent,    size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_parent))    index->parent    = new_parent;
+
+    link_t   *new_cnt_nodes = (link_t*)   realloc (index->cnt_nodes, size_arrays * sizeof (link_t));
+    if (!Check_nullptr (new_cnt_nodes)) index->cnt_nodes = new_cnt_nodes;
+
+    uint32_t *new_priority  = (uint32_t*) realloc (index->priority,  size_arrays * sizeof (uint32_t));
+    if (!Check_nullptr (new_priority))  index->priority  = new_priority;
+
+    if (Check_nullptr (new_left)      || Check_nullptr (new_right)    || Check_nullptr (new_parent) ||
+        Check_nullptr (new_cnt_nodes) || Check_nullptr (new_priority))
+    {
+        Log_report ("Index arrays reallocation error, new_capacity = %ld\n", new_capacity);
+        index->is_valid = 0;
+        return INDEX_RESIZE_ERR;
+    }
+
+    index->capacity = new_capacity;
+
+    index->cnt_nodes[Dummy_element] = 0;
+
+    return 0;
+}
+
+//======================================================================================
+
+void List_index_clear (List_index *index)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    index->root     = Dummy_element;
+    index->is_valid = 1;
+
+    index->cnt_nodes[Dummy_element] = 0;
+
+    return;
+}
+
+//======================================================================================
+
+int List_index_build (List_index *index, const List *list)
+{
+    assert (index != nullptr && "index is nullptr");
+    assert (list  != nullptr && "list is nullptr");
+
+    if (index->capacity < list->capacity && List_index_resize (index, list->capacity))
+        return INDEX_RESIZE_ERR;
+
+    List_index_clear (index);
+
+    //Treap is built as a Cartesian tree: the right spine is walked by parent pointers
+    link_t last_node = Dummy_element;
+
+    for (link_t node = list->head_ptr; node != Dummy_element; node = Node_next (list, node))
+    {
+        index->right[node]    = Dummy_element;
+        index->priority[node] = Index_random (index);
+
+        link_t spine_node = last_node;
+        link_t child      = Dummy_element;
+
+        while (spine_node != Dummy_element && index->priority[spine_node] < index->priority[node])
+        {
+            child      = spine_node;
+            spine_node = index->parent[spine_node];
+        }
+
+        index->left[node] = child;
+        if (child != Dummy_element) index->parent[child] = node;
+
+        index->parent[node] = spine_node;
+
+        if (spine_node != Dummy_element)
+            index->right[spine_node] = node;
+        else
+            index->root = node;
+
+        last_node = node;
+    }
+
+    Index_count_subtrees (index);
+
+    return 0;
+}
+
+//======================================================================================
+
+static void Index_count_subtrees (List_index *index)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    //Post-order traversal by parent pointers without a stack
+    link_t node      = index->root;
+    link_t prev_node = Dummy_element;
+
+    while (node != Dummy_element)
+    {
+        link_t next_node = index->parent[node];
+
+        if (prev_node == index->parent[node])
+        {
+            if      (index->left[node]  != Dummy_element) next_node = index->left[node];
+            else if (index->right[node] != Dummy_element) next_node = index->right[node];
+        }
+        else if (prev_node == index->left[node] && index->right[node] != Dummy_element)
+            next_node = index->right[node];
+
+        if (next_node == index->parent[node])
+            Index_update (index, node);
+
+        prev_node = node;
+        node      = next_node;
+    }
+
+    return;
+}
+
+//======================================================================================
+
+int List_index_insert_after (List_index *index, const link_t prev_ind, const link_t ind)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    if (ind <= Dummy_element || ind > index->capacity || prev_ind < 0 || prev_ind > index->capacity)
+    {
+        Log_report ("Incorrect nodes: prev_ind = %" LINK_T_SPEC ", ind = %" LINK_T_SPEC "\n", prev_ind, ind);
+        return INDEX_INSERT_ERR;
+    }
+
+    index->left[ind]      = Dummy_element;
+    index->right[ind]     = Dummy_element;
+    index->cnt_nodes[ind] = 1;
+    index->priority[ind]  = Index_random (index);
+
+    link_t parent_node = Dummy_element;
+
+    if (index->root == Dummy_element)
+    {
+        index->root = ind;
+    }
+    else if (prev_ind == Dummy_element || index->right[prev_ind] != Dummy_element)
+    {
+        //The new node is the leftmost node of the subtree after prev_ind
+        parent_node = (prev_ind == Dummy_element) ? index->root : index->right[prev_ind];
+
+        while (index->left[parent_node] != Dummy_element)
+            parent_node = index->left[parent_node];
+
+        index->left[parent_node] = ind;
+    }
+    else
+    {
+        parent_node = prev_ind;
+        index->right[parent_node] = ind;
+    }
+
+    index->parent[ind] = parent_node;
+
+    for (link_t node = parent_node; node != Dummy_element; node = index->parent[node])
+        index->cnt_nodes[node]++;
+
+    while (index->parent[ind] != Dummy_element &&
+           index->priority[index->parent[ind]] < index->priority[ind])
+        Index_rotate_up (index, ind);
+
+    return 0;
+}
+
+//======================================================================================
+
+int List_index_erase (List_index *index, const link_t ind)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    if (ind <= Dummy_element || ind > index->capacity)
+    {
+        Log_report ("Incorrect node: ind = %" LINK_T_SPEC "\n", ind);
+        return INDEX_ERASE_ERR;
+    }
+
+    while (index->left[ind] != Dummy_element && index->right[ind] != Dummy_element)
+    {
+        link_t left_child  = index->left[ind];
+        link_t right_child = index->right[ind];
+
+        Index_rotate_up (index, (index->priority[left_child] > index->priority[right_child]) ?
+                                 left_child : right_child);
+    }
+
+    link_t child       = (index->left[ind] != Dummy_element) ? index->left[ind] : index->right[ind];
+    link_t parent_node = index->parent[ind];
+
+    if (child != Dummy_element)
+        index->parent[child] = parent_node;
+
+    if (parent_node == Dummy_element)
+        index->root = child;
+    else if (index->left[parent_node] == ind)
+        index->left[parent_node] = child;
+    else
+        index->right[parent_node] = child;
+
+    for (link_t node = parent_node; node != Dummy_element; node = index->parent[node])
+        index->cnt_nodes[node]--;
+
+    index->left[ind]      = Dummy_element;
+    index->right[ind]     = Dummy_element;
+    index->parent[ind]    = Dummy_element;
+    index->cnt_nodes[ind] = 0;
+
+    return 0;
+}
+
+//======================================================================================
+
+void List_index_move (List_index *index, const link_t to_ind, const link_t from_ind, const int is_swap)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    link_t moved_nodes[2] = {from_ind, to_ind};
+    int    cnt_moved      = is_swap ? 2 : 1;
+
+    //Tree neighbours that are not moved point to the new places of the moved nodes
+    for (int it = 0; it < cnt_moved; it++)
+    {
+        link_t node        = moved_nodes[it];
+        link_t parent_node = index->parent[node];
+
+        int is_outside = (parent_node != Dummy_element && parent_node != from_ind && parent_node != to_ind);
+
+        if (is_outside && !(it == 1 && parent_node == index->parent[from_ind]))      //<- A common parent is fixed once
+        {
+            index->left[parent_node]  = Index_relabel (index->left[parent_node],  to_ind, from_ind);
+            index->right[parent_node] = Index_relabel (index->right[parent_node], to_ind, from_ind);
+        }
+
+        link_t children[2] = {index->left[node], index->right[node]};
+
+        for (int child_it = 0; child_it < 2; child_it++)
+        {
+            link_t child = children[child_it];
+
+            if (child != Dummy_element && child != from_ind && child != to_ind)
+                index->parent[child] = Index_relabel (node, to_ind, from_ind);
+        }
+    }
+
+    index->root = Index_relabel (index->root, to_ind, from_ind);
+
+    link_t   from_left      = index->left[from_ind];
+    link_t   from_right     = index->right[from_ind];
+    link_t   from_parent    = index->parent[from_ind];
+    link_t   from_cnt_nodes = index->cnt_nodes[from_ind];
+    uint32_t from_priority  = index->priority[from_ind];
+
+    if (is_swap)
+    {
+        index->left[from_ind]      = Index_relabel (index->left[to_ind],   to_ind, from_ind);
+        index->right[from_ind]     = Index_relabel (index->right[to_ind],  to_ind, from_ind);
+        index->parent[from_ind]    = Index_relabel (index->parent[to_ind], to_ind, from_ind);
+        index->cnt_nodes[from_ind] = index->cnt_nodes[to_ind];
+        index->priority[from_ind]  = index->priority[to_ind];
+    }
+    else
+    {
+        index->left[from_ind]      = Dummy_element;
+        index->right[from_ind]     = Dummy_element;
+        index->parent[from_ind]    = Dummy_element;
+        index->cnt_nodes[from_ind] = 0;
+    }
+
+    index->left[to_ind]      = Index_relabel (from_left,   to_ind, from_ind);
+    index->right[to_ind]     = Index_relabel (from_right,  to_ind, from_ind);
+    index->parent[to_ind]    = Index_relabel (from_parent, to_ind, from_ind);
+    index->cnt_nodes[to_ind] = from_cnt_nodes;
+    index->priority[to_ind]  = from_priority;
+
+    return;
+}
+
+//======================================================================================
+
+link_t List_index_select (const List_index *index, const long rank)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    long   cur_rank = rank;
+    link_t node     = index->root;
+
+    while (node != Dummy_element)
+    {
+        long cnt_left = index->cnt_nodes[index->left[node]];
+
+        if (cur_rank <= cnt_left)
+            node = index->left[node];
+
+        else if (cur_rank == cnt_left + 1)
+            return node;
+
+        else
+        {
+            cur_rank -= cnt_left + 1;
+            node = index->right[node];
+        }
+    }
+
+    Log_report ("Rank is out of the index: rank = %ld\n", rank);
+    return INDEX_SELECT_ERR;
+}
+
+//======================================================================================
+
+long List_index_rank (const List_index *index, const link_t ind)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    if (ind <= Dummy_element || ind > index->capacity)
+    {
+        Log_report ("Incorrect node: ind = %" LINK_T_SPEC "\n", ind);
+        return INDEX_RANK_ERR;
+    }
+
+    long rank = index->cnt_nodes[index->left[ind]] + 1;
+
+    for (link_t node = ind; index->parent[node] != Dummy_element; node = index->parent[node])
+    {
+        link_t parent_node = index->parent[node];
+
+        if (index->right[parent_node] == node)
+            rank += index->cnt_nodes[index->left[parent_node]] + 1;
+    }
+
+    return rank;
+}
+
+//======================================================================================
+
+static void Index_rotate_up (List_index *index, const link_t node)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    link_t parent_node = index->parent[node];
+    link_t grand_node  = index->parent[parent_node];
+
+    if (index->left[parent_node] == node)
+    {
+        index->left[parent_node] = index->right[node];
+        if (index->right[node] != Dummy_element) index->parent[index->right[node]] = parent_node;
+
+        index->right[node] = parent_node;
+    }
+    else
+    {
+        index->right[parent_node] = index->left[node];
+        if (index->left[node] != Dummy_element) index->parent[index->left[node]] = parent_node;
+
+        index->left[node] = parent_node;
+    }
+
+    index->parent[parent_node] = node;
+    index->parent[node]        = grand_node;
+
+    if (grand_node == Dummy_element)
+        index->root = node;
+    else if (index->left[grand_node] == parent_node)
+        index->left[grand_node] = node;
+    else
+        index->right[grand_node] = node;
+
+    Index_update (index, parent_node);
+    Index_update (index, node);
+
+    return;
+}
+
+//======================================================================================
+
+static void Index_update (List_index *index, const link_t node)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    index->cnt_nodes[node] = (link_t) (index->cnt_nodes[index->left[node]] +
+                                       index->cnt_nodes[index->right[node]] + 1);
+
+    return;
+}
+
+//======================================================================================
+
+static link_t Index_relabel (const link_t node, const link_t to_ind, const link_t from_ind)
+{
+    if (node == from_ind) return to_ind;
+    if (node == to_ind)   return from_ind;
+
+    return node;
+}
+
+//======================================================================================
+
+static uint32_t Index_random (List_index *index)
+{
+    assert (index != nullptr && "index is nullptr");
+
+    //xorshift32
+    index->seed ^= index->seed << 13;
+    index->seed ^= index->seed >> 17;
+    index->seed ^= index->seed << 5;
+
+    return index->seed;
+}
+
+//======================================================================================
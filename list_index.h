@@ -0,0 +1,94 @@
+#ifndef _LIST_INDEX_H_
+#define _LIST_INDEX_H_
+
+#include <stdint.h>
+
+#include "list.h"
+
+//Order-statistics index over the nodes of a List: an implicit treap whose in-order
+//traversal is the logical order of the list. Arrays are indexed by physical pointers,
+//zero (Dummy_element) is the empty subtree.
+
+struct List_index
+{
+    link_t *left   = nullptr;
+    link_t *right  = nullptr;
+    link_t *parent = nullptr;
+
+    link_t   *cnt_nodes = nullptr;      //<- Number of nodes in the subtree
+    uint32_t *priority  = nullptr;
+
+    long capacity = 0;
+
+    link_t root     = 0;
+    int    is_valid = 0;                  //<- Zero means that the index must be rebuilt before use
+
+    uint32_t seed = 0;
+};
+
+
+enum List_index_func_err
+{
+    INDEX_CTOR_ERR      = -1,
+    INDEX_DTOR_ERR      = -2,
+
+    INDEX_RESIZE_ERR    = -3,
+
+    INDEX_INSERT_ERR    = -4,
+    INDEX_ERASE_ERR     = -5,
+
+    INDEX_SELECT_ERR    = -6,
+    INDEX_RANK_ERR      = -7,
+};
+
+
+int List_index_ctor   (List_index *index, const long capacity);
+
+int List_index_dtor   (List_index *index);
+
+int List_index_resize (List_index *index, const long new_capacity);
+
+void List_index_clear (List_index *index);
+
+/**
+ * @brief Builds the index in O(n)
+ * @version 1.0.0
+ * @param [in] *index Structure List_index pointer
+ * @param [in] *list Structure List pointer, the index gets its logical order
+ * @return Returns zero if the index is built, otherwise returns a non-zero number
+*/
+int List_index_build (List_index *index, const List *list);
+
+/**
+ * @brief Adds node ind right after node prev_ind in logical order
+ * @version 1.0.0
+ * @param [in] *index Structure List_index pointer
+ * @param [in] prev_ind The previous node, zero means adding to the front
+ * @param [in] ind The added node
+ * @return Returns zero if the node is added, otherwise returns a non-zero number
+*/
+int List_index_insert_after (List_index *index, const link_t prev_ind, const link_t ind);
+
+int List_index_erase  (List_index *index, const link_t ind);
+
+/**
+ * @brief Follows the node moved from from_ind to to_ind in O(1), the logical order is not changed
+ * @param [in] is_swap Non-zero if the node of to_ind is moved to from_ind at the same time
+*/
+void List_index_move (List_index *index, const link_t to_ind, const link_t from_ind, const int is_swap);
+
+/**
+ * @brief Physical pointer of the node with the given logical order
+ * @param [in] rank Logical order, starting from 1
+ * @return Returns the physical pointer, otherwise a negative number
+*/
+link_t List_index_select (const List_index *index, const long rank);
+
+/**
+ * @brief Logical order of the node, starting from 1
+ * @param [in] ind Physical pointer of the node in the index
+ * @return Returns the logical order, otherwise a negative number
+*/
+long List_index_rank  (const List_index *index, const link_t ind);
+
+#endif  //#endif _LIST_INDEX_H_
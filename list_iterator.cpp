@@ -0,0 +1,8 @@
+#include "list_iterator.h"
+
+//The iterator templates are instantiated here, so every member is compiled with the flags of the project
+//for the node layout and link_t of the build.
+
+template class List_iterator_base<List, elem_t>;
+
+template class List_iterator_base<const List, const elem_t>;
@@ -0,0 +1,149 @@
+#ifndef _LIST_ITERATOR_H_
+#define _LIST_ITERATOR_H_
+
+#include <stddef.h>
+#include <iterator>
+
+#include "list.h"
+
+//Traversal over Node::next/prev without per-step verification of the list.
+//Cursors and iterators are invalidated by List_recalloc and List_linearize.
+
+struct List_cursor
+{
+    const List *list = nullptr;
+    link_t ind = Dummy_element;     //<- Physical index of the current node, Dummy_element is the end
+};
+
+
+inline List_cursor List_begin (const List *list)
+{
+    return List_cursor {list, list->head_ptr};
+}
+
+inline List_cursor List_end (const List *list)
+{
+    return List_cursor {list, Dummy_element};
+}
+
+inline void List_next (List_cursor *cursor)
+{
+    cursor->ind = Node_next (cursor->list, cursor->ind);
+}
+
+/**
+ * @brief Moves cursor to the previous node
+ * @note List_prev of List_end gives the tail, as the dummy element links to it
+*/
+inline void List_prev (List_cursor *cursor)
+{
+    cursor->ind = Node_prev (cursor->list, cursor->ind);
+}
+
+inline elem_t List_deref (const List_cursor *cursor)
+{
+    return Node_val (cursor->list, cursor->ind);
+}
+
+inline int List_cursor_equal (const List_cursor *first, const List_cursor *second)
+{
+    return first->list == second->list && first->ind == second->ind;
+}
+
+//======================================================================================
+
+template <typename List_type, typename Elem_type>
+class List_iterator_base
+{
+    public:
+
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef elem_t                          value_type;
+        typedef ptrdiff_t                       difference_type;
+        typedef Elem_type*                      pointer;
+        typedef Elem_type&                      reference;
+
+        List_iterator_base () {}
+
+        List_iterator_base (List_type *list, const link_t ind) : list_ (list), ind_ (ind) {}
+
+        //Iterator converts to the const iterator
+        operator List_iterator_base<const List, const elem_t> () const
+        {
+            return List_iterator_base<const List, const elem_t> (list_, ind_);
+        }
+
+        reference operator*  () const { return  Node_val (list_, ind_); }
+        pointer   operator-> () const { return &Node_val (list_, ind_); }
+
+        List_iterator_base &operator++ ()
+        {
+            ind_ = Node_next (list_, ind_);
+            return *this;
+        }
+
+        List_iterator_base operator++ (int)
+        {
+            List_iterator_base old = *this;
+            ind_ = Node_next (list_, ind_);
+            return old;
+        }
+
+        List_iterator_base &operator-- ()
+        {
+            ind_ = Node_prev (list_, ind_);
+            return *this;
+        }
+
+        List_iterator_base operator-- (int)
+        {
+            List_iterator_base old = *this;
+            ind_ = Node_prev (list_, ind_);
+            return old;
+        }
+
+        bool operator== (const List_iterator_base &other) const
+        {
+            return list_ == other.list_ && ind_ == other.ind_;
+        }
+
+        bool operator!= (const List_iterator_base &other) const
+        {
+            return !(*this == other);
+        }
+
+        link_t ind () const { return ind_; }    //<- Physical index for List_erase and others
+
+    private:
+
+        List_type *list_ = nullptr;
+        link_t ind_ = Dummy_element;
+};
+
+typedef List_iterator_base<List, elem_t>             List_iterator;
+typedef List_iterator_base<const List, const elem_t> List_const_iterator;
+
+
+//Range-for support: for (elem_t val : list)
+
+inline List_iterator begin (List &list)
+{
+    return List_iterator (&list, list.head_ptr);
+}
+
+inline List_iterator end (List &list)
+{
+    return List_iterator (&list, Dummy_element);
+}
+
+inline List_const_iterator begin (const List &list)
+{
+    return List_const_iterator (&list, list.head_ptr);
+}
+
+inline List_const_iterator end (const List &list)
+{
+    return List_const_iterator (&list, Dummy_element);
+}
+
+#endif  //#endif _LIST_ITERATOR_H_
@@ -0,0 +1,264 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "list_parallel.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+
+struct Thread_pool
+{
+    std::vector<std::thread> workers;
+
+    std::mutex run_mutex;                       //<- Jobs and changes of the pool go one by one
+    std::mutex job_mutex;
+
+    std::condition_variable job_started;
+    std::condition_variable job_finished;
+
+    Parallel_task_t task;
+    void *arg;
+
+    long cnt_tasks;
+    std::atomic<long> next_task;
+
+    unsigned long job_id;                       //<- Workers wait for a new value
+    long cnt_working;                           //<- Workers that have not finished the current job
+
+    int cnt_threads;                            //<- Zero until the pool is started
+    int is_stopped;
+
+    Thread_pool ();
+
+    ~Thread_pool ();
+
+    Thread_pool (const Thread_pool &)            = delete;
+    Thread_pool &operator= (const Thread_pool &) = delete;
+};
+
+static Thread_pool Pool;
+
+static void Pool_worker (Thread_pool *pool, unsigned long last_job_id);
+
+static void Pool_work   (Thread_pool *pool);
+
+static int  Pool_start  (Thread_pool *pool, const int cnt_threads);
+
+static void Pool_stop   (Thread_pool *pool);
+
+//======================================================================================
+
+int Parallel_run (const long cnt_tasks, Parallel_task_t task, void *arg)
+{
+    assert (task != nullptr && "task is nullptr");
+
+    if (cnt_tasks < 0)
+    {
+        Log_report ("Incorrect cnt_tasks = %ld\n", cnt_tasks);
+        return PARALLEL_RUN_ERR;
+    }
+
+    std::lock_guard<std::mutex> run_lock (Pool.run_mutex);
+
+    if (Pool.cnt_threads == 0 && Pool_start (&Pool, 0))
+    {
+        Log_report ("Thread pool start error\n");
+        Err_report ();
+        return PARALLEL_RUN_ERR;
+    }
+
+    if (Pool.workers.empty () || cnt_tasks <= 1)
+    {
+        for (long task_ind = 0; task_ind < cnt_tasks; task_ind++)
+            task (task_ind, arg);
+
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> job_lock (Pool.job_mutex);
+
+        Pool.task      = task;
+        Pool.arg       = arg;
+        Pool.cnt_tasks = cnt_tasks;
+        Pool.next_task = 0;
+
+        Pool.cnt_working = (long) Pool.workers.size ();
+        Pool.job_id++;
+    }
+
+    Pool.job_started.notify_all ();
+
+    Pool_work (&Pool);      //<- The calling thread takes tasks too
+
+    std::unique_lock<std::mutex> job_lock (Pool.job_mutex);
+    Pool.job_finished.wait (job_lock, [] { return Pool.cnt_working == 0; });
+
+    return 0;
+}
+
+//======================================================================================
+
+int Parallel_set_threads (const int cnt_threads)
+{
+    if (cnt_threads < 0)
+    {
+        Log_report ("Incorrect cnt_threads = %d\n", cnt_threads);
+        return PARALLEL_THREADS_ERR;
+    }
+
+    std::lock_guard<std::mutex> run_lock (Pool.run_mutex);
+
+    Pool_stop (&Pool);
+
+    if (Pool_start (&Pool, cnt_threads))
+    {
+        Log_report ("Thread pool start error, cnt_threads = %d\n", cnt_threads);
+        Err_report ();
+        return PARALLEL_THREADS_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int Parallel_get_threads ()
+{
+    std::lock_guard<std::mutex> run_lock (Pool.run_mutex);
+
+    if (Pool.cnt_threads == 0 && Pool_start (&Pool, 0))
+        return 1;
+
+    return Pool.cnt_threads;
+}
+
+//======================================================================================
+
+static int Pool_start (Thread_pool *pool, const int cnt_threads)
+{
+    assert (pool != nullptr && "pool is nullptr");
+
+    int new_cnt_threads = cnt_threads;
+
+    if (new_cnt_threads == 0)
+        new_cnt_threads = (int) std::thread::hardware_concurrency ();
+
+    if (new_cnt_threads <= 0)
+        new_cnt_threads = 1;
+
+    pool->is_stopped  = 0;
+    pool->cnt_threads = new_cnt_threads;
+
+    try
+    {
+        for (int it = 1; it < new_cnt_threads; it++)
+            pool->workers.emplace_back (Pool_worker, pool, pool->job_id);
+    }
+    catch (const std::system_error &)
+    {
+        //The pool works with the threads that have been started
+        pool->cnt_threads = (int) pool->workers.size () + 1;
+        return PARALLEL_THREADS_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static void Pool_stop (Thread_pool *pool)
+{
+    assert (pool != nullptr && "pool is nullptr");
+
+    {
+        std::lock_guard<std::mutex> job_lock (pool->job_mutex);
+        pool->is_stopped = 1;
+    }
+
+    pool->job_started.notify_all ();
+
+    for (std::thread &worker : pool->workers)
+        worker.join ();
+
+    pool->workers.clear ();
+    pool->cnt_threads = 0;
+
+    return;
+}
+
+//======================================================================================
+
+static void Pool_worker (Thread_pool *pool, unsigned long last_job_id)
+{
+    assert (pool != nullptr && "pool is nullptr");
+
+    //last_job_id is taken when the worker is created, so a job started before the first wait is not missed
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> job_lock (pool->job_mutex);
+            pool->job_started.wait (job_lock, [&] { return pool->is_stopped || pool->job_id != last_job_id; });
+
+            if (pool->is_stopped) return;
+
+            last_job_id = pool->job_id;
+        }
+
+        Pool_work (pool);
+
+        std::lock_guard<std::mutex> job_lock (pool->job_mutex);
+
+        if (--pool->cnt_working == 0)
+            pool->job_finished.notify_one ();
+    }
+}
+
+//======================================================================================
+
+static void Pool_work (Thread_pool *pool)
+{
+    assert (pool != nullptr && "pool is nullptr");
+
+    long task_ind = 0;
+
+    while ((task_ind = pool->next_task.fetch_add (1)) < pool->cnt_tasks)
+        pool->task (task_ind, pool->arg);
+
+    return;
+}
+
+//======================================================================================
+
+Thread_pool::Thread_pool ():
+    workers      (),
+    run_mutex    (),
+    job_mutex    (),
+    job_started  (),
+    job_finished (),
+    task         (nullptr),
+    arg          (nullptr),
+    cnt_tasks    (0),
+    next_task    (0),
+    job_id       (0),
+    cnt_working  (0),
+    cnt_threads  (0),
+    is_stopped   (0)
+{}
+
+//======================================================================================
+
+Thread_pool::~Thread_pool ()
+{
+    Pool_stop (this);
+}
+
+//======================================================================================
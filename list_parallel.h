@@ -0,0 +1,37 @@
+#ifndef _LIST_PARALLEL_H_
+#define _LIST_PARALLEL_H_
+
+//Pool of worker threads for the parallel List functions. Tasks of one job are taken by the
+//workers and the calling thread from a shared counter, jobs of different threads run one by one.
+
+typedef void (*Parallel_task_t) (const long task_ind, void *arg);
+
+enum Parallel_func_err
+{
+    PARALLEL_THREADS_ERR    = -1,
+    PARALLEL_RUN_ERR        = -2,
+};
+
+
+/**
+ * @brief Runs task for every task_ind from 0 to cnt_tasks - 1 on the pool
+ * @version 1.0.0
+ * @param [in] cnt_tasks Number of tasks
+ * @param [in] task The task, it is called from different threads at the same time
+ * @param [in] *arg Argument of the task
+ * @return Returns zero when all tasks are done, otherwise returns a non-zero number
+ * @note The pool is started by the first call
+*/
+int Parallel_run (const long cnt_tasks, Parallel_task_t task, void *arg);
+
+/**
+ * @brief Sets the number of threads of the pool, the calling thread is counted
+ * @version 1.0.0
+ * @param [in] cnt_threads Number of threads, zero means the number of hardware threads
+ * @return Returns zero if the number is set, otherwise returns a non-zero number
+*/
+int Parallel_set_threads (const int cnt_threads);
+
+int Parallel_get_threads ();
+
+#endif  //#endif _LIST_PARALLEL_H_
@@ -0,0 +1,455 @@
+#include <stdint.h>
+#include <type_traits>
+
+#if defined (__x86_64__) || defined (__i386__)
+
+    #include <immintrin.h>
+
+    #define LIST_SIMD_X86
+
+#endif
+
+#include "list_simd.h"
+
+
+typedef long (*Elems_scan_t) (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+//stride is the number of 32-bit words between neighbouring values
+typedef long (*Elems_strided_scan_t) (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+struct Elems_scan_impl
+{
+    Elems_scan_t find  = nullptr;
+    Elems_scan_t count = nullptr;
+
+    Elems_strided_scan_t find_strided  = nullptr;
+    Elems_strided_scan_t count_strided = nullptr;
+
+    const char *isa = nullptr;
+};
+
+//Values are compared as 32-bit integers only when this is their exact meaning
+const bool Is_simd_elem = std::is_integral<elem_t>::value && sizeof (elem_t) == sizeof (int32_t);
+
+const long Max_count_block = 1L << 24;      //<- Vector iterations before the lane counters are summed, they stay far below INT32_MAX
+
+static const Elems_scan_impl* Get_scan_impl ();
+
+static Elems_scan_impl Choose_scan_impl ();
+
+static long Find_scalar  (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+static long Count_scalar (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+static long Find_strided_scalar  (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+static long Count_strided_scalar (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+#ifdef LIST_SIMD_X86
+
+    static long Find_sse2  (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+    static long Count_sse2 (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+    static long Find_avx2  (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+    static long Count_avx2 (const int32_t *vals, const long cnt_vals, const int32_t val);
+
+    static long Find_strided_sse2  (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+    static long Count_strided_sse2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+    static __m128i Load_strided_sse2 (const int32_t *vals, const long stride);
+
+    static long Find_strided_avx2  (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+    static long Count_strided_avx2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val);
+
+#endif
+
+//======================================================================================
+
+long Elems_find (const elem_t *vals, const long cnt_vals, const size_t stride, const elem_t val)
+{
+    if (Is_simd_elem && stride == sizeof (elem_t))
+        return Get_scan_impl ()->find ((const int32_t*) vals, cnt_vals, (int32_t) val);
+
+    if (Is_simd_elem && stride % sizeof (int32_t) == 0)
+        return Get_scan_impl ()->find_strided ((const int32_t*) vals, cnt_vals, (long) (stride / sizeof (int32_t)), (int32_t) val);
+
+    const char *cur_val = (const char*) vals;
+
+    for (long it = 0; it < cnt_vals; it++, cur_val += stride)
+        if (*(const elem_t*) cur_val == val) return it;
+
+    return -1;
+}
+
+//======================================================================================
+
+long Elems_count (const elem_t *vals, const long cnt_vals, const size_t stride, const elem_t val)
+{
+    if (Is_simd_elem && stride == sizeof (elem_t))
+        return Get_scan_impl ()->count ((const int32_t*) vals, cnt_vals, (int32_t) val);
+
+    if (Is_simd_elem && stride % sizeof (int32_t) == 0)
+        return Get_scan_impl ()->count_strided ((const int32_t*) vals, cnt_vals, (long) (stride / sizeof (int32_t)), (int32_t) val);
+
+    const char *cur_val = (const char*) vals;
+    long cnt_equal = 0;
+
+    for (long it = 0; it < cnt_vals; it++, cur_val += stride)
+        cnt_equal += (*(const elem_t*) cur_val == val);
+
+    return cnt_equal;
+}
+
+//======================================================================================
+
+const char* Elems_scan_isa ()
+{
+    return Get_scan_impl ()->isa;
+}
+
+//======================================================================================
+
+static const Elems_scan_impl* Get_scan_impl ()
+{
+    //Chosen once, the initialization of a local static is thread-safe
+    static const Elems_scan_impl impl = Choose_scan_impl ();
+
+    return &impl;
+}
+
+//======================================================================================
+
+static Elems_scan_impl Choose_scan_impl ()
+{
+    Elems_scan_impl new_impl = {Find_scalar, Count_scalar, Find_strided_scalar, Count_strided_scalar, "scalar"};
+
+    #ifdef LIST_SIMD_X86
+
+        __builtin_cpu_init ();
+
+        if (__builtin_cpu_supports ("avx2"))
+            new_impl = {Find_avx2, Count_avx2, Find_strided_avx2, Count_strided_avx2, "avx2"};
+
+        else if (__builtin_cpu_supports ("sse2"))
+            new_impl = {Find_sse2, Count_sse2, Find_strided_sse2, Count_strided_sse2, "sse2"};
+
+    #endif
+
+    return new_impl;
+}
+
+//======================================================================================
+
+static long Find_scalar (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    for (long it = 0; it < cnt_vals; it++)
+        if (vals[it] == val) return it;
+
+    return -1;
+}
+
+//======================================================================================
+
+static long Count_scalar (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    long cnt_equal = 0;
+
+    for (long it = 0; it < cnt_vals; it++)
+        cnt_equal += (vals[it] == val);
+
+    return cnt_equal;
+}
+
+//======================================================================================
+
+static long Find_strided_scalar (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    for (long it = 0; it < cnt_vals; it++)
+        if (vals[it * stride] == val) return it;
+
+    return -1;
+}
+
+//======================================================================================
+
+static long Count_strided_scalar (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    long cnt_equal = 0;
+
+    for (long it = 0; it < cnt_vals; it++)
+        cnt_equal += (vals[it * stride] == val);
+
+    return cnt_equal;
+}
+
+//======================================================================================
+
+#ifdef LIST_SIMD_X86
+
+__attribute__ ((target ("sse2")))
+static long Find_sse2 (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    const __m128i key = _mm_set1_epi32 (val);
+
+    long it = 0;
+
+    for (; it + 4 <= cnt_vals; it += 4)
+    {
+        __m128i equal = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i*) (vals + it)), key);
+
+        int mask = _mm_movemask_ps (_mm_castsi128_ps (equal));
+
+        if (mask) return it + __builtin_ctz ((unsigned) mask);
+    }
+
+    long tail_pos = Find_scalar (vals + it, cnt_vals - it, val);
+
+    return (tail_pos >= 0) ? it + tail_pos : -1;
+}
+
+//======================================================================================
+
+__attribute__ ((target ("sse2")))
+static long Count_sse2 (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    const __m128i key = _mm_set1_epi32 (val);
+
+    long it = 0;
+    long cnt_equal = 0;
+
+    while (it + 4 <= cnt_vals)
+    {
+        __m128i lane_counters = _mm_setzero_si128 ();
+
+        //Equal lanes are -1, so they are subtracted
+        for (long block = 0; block < Max_count_block && it + 4 <= cnt_vals; block++, it += 4)
+            lane_counters = _mm_sub_epi32 (lane_counters,
+                                           _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i*) (vals + it)), key));
+
+        int32_t lanes[4] = {};
+        _mm_storeu_si128 ((__m128i*) lanes, lane_counters);
+
+        cnt_equal += (long) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    return cnt_equal + Count_scalar (vals + it, cnt_vals - it, val);
+}
+
+//======================================================================================
+
+__attribute__ ((target ("avx2")))
+static long Find_avx2 (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    const __m256i key = _mm256_set1_epi32 (val);
+
+    long it = 0;
+
+    //Two vectors per iteration, the second load is issued before the first mask is checked
+    for (; it + 16 <= cnt_vals; it += 16)
+    {
+        __m256i first_equal  = _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i*) (vals + it)),     key);
+        __m256i second_equal = _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i*) (vals + it + 8)), key);
+
+        if (_mm256_testz_si256 (_mm256_or_si256 (first_equal, second_equal),
+                                _mm256_or_si256 (first_equal, second_equal))) continue;
+
+        int first_mask = _mm256_movemask_ps (_mm256_castsi256_ps (first_equal));
+
+        if (first_mask) return it + __builtin_ctz ((unsigned) first_mask);
+
+        return it + 8 + __builtin_ctz ((unsigned) _mm256_movemask_ps (_mm256_castsi256_ps (second_equal)));
+    }
+
+    for (; it + 8 <= cnt_vals; it += 8)
+    {
+        int mask = _mm256_movemask_ps (_mm256_castsi256_ps (
+                   _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i*) (vals + it)), key)));
+
+        if (mask) return it + __builtin_ctz ((unsigned) mask);
+    }
+
+    long tail_pos = Find_scalar (vals + it, cnt_vals - it, val);
+
+    return (tail_pos >= 0) ? it + tail_pos : -1;
+}
+
+//======================================================================================
+
+__attribute__ ((target ("avx2")))
+static long Count_avx2 (const int32_t *vals, const long cnt_vals, const int32_t val)
+{
+    const __m256i key = _mm256_set1_epi32 (val);
+
+    long it = 0;
+    long cnt_equal = 0;
+
+    while (it + 8 <= cnt_vals)
+    {
+        __m256i lane_counters = _mm256_setzero_si256 ();
+
+        for (long block = 0; block < Max_count_block && it + 8 <= cnt_vals; block++, it += 8)
+            lane_counters = _mm256_sub_epi32 (lane_counters,
+                                              _mm256_cmpeq_epi32 (_mm256_loadu_si256 ((const __m256i*) (vals + it)), key));
+
+        int32_t lanes[8] = {};
+        _mm256_storeu_si256 ((__m256i*) lanes, lane_counters);
+
+        for (int lane = 0; lane < 8; lane++)
+            cnt_equal += lanes[lane];
+    }
+
+    return cnt_equal + Count_scalar (vals + it, cnt_vals - it, val);
+}
+
+//======================================================================================
+
+__attribute__ ((target ("sse2")))
+static long Find_strided_sse2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    //Only the nodes of 8 and 12 bytes are shuffled
+    if (stride != 2 && stride != 3)
+        return Find_strided_scalar (vals, cnt_vals, stride, val);
+
+    const __m128i key = _mm_set1_epi32 (val);
+
+    long it = 0;
+
+    //Loads of 4 values take 4 whole strides, one more value after them keeps the loads before the last value
+    for (; it + 5 <= cnt_vals; it += 4)
+    {
+        __m128i equal = _mm_cmpeq_epi32 (Load_strided_sse2 (vals + it * stride, stride), key);
+
+        int mask = _mm_movemask_ps (_mm_castsi128_ps (equal));
+
+        if (mask) return it + __builtin_ctz ((unsigned) mask);
+    }
+
+    long tail_pos = Find_strided_scalar (vals + it * stride, cnt_vals - it, stride, val);
+
+    return (tail_pos >= 0) ? it + tail_pos : -1;
+}
+
+//======================================================================================
+
+__attribute__ ((target ("sse2")))
+static long Count_strided_sse2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    if (stride != 2 && stride != 3)
+        return Count_strided_scalar (vals, cnt_vals, stride, val);
+
+    const __m128i key = _mm_set1_epi32 (val);
+
+    long it = 0;
+    long cnt_equal = 0;
+
+    while (it + 5 <= cnt_vals)
+    {
+        __m128i lane_counters = _mm_setzero_si128 ();
+
+        for (long block = 0; block < Max_count_block && it + 5 <= cnt_vals; block++, it += 4)
+            lane_counters = _mm_sub_epi32 (lane_counters,
+                                           _mm_cmpeq_epi32 (Load_strided_sse2 (vals + it * stride, stride), key));
+
+        int32_t lanes[4] = {};
+        _mm_storeu_si128 ((__m128i*) lanes, lane_counters);
+
+        cnt_equal += (long) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    return cnt_equal + Count_strided_scalar (vals + it * stride, cnt_vals - it, stride, val);
+}
+
+//======================================================================================
+
+__attribute__ ((target ("sse2")))
+static __m128i Load_strided_sse2 (const int32_t *vals, const long stride)
+{
+    if (stride == 2)
+    {
+        //[v0 x v1 x] [v2 x v3 x]
+        __m128 first  = _mm_castsi128_ps (_mm_loadu_si128 ((const __m128i*) vals));
+        __m128 second = _mm_castsi128_ps (_mm_loadu_si128 ((const __m128i*) (vals + 4)));
+
+        return _mm_castps_si128 (_mm_shuffle_ps (first, second, _MM_SHUFFLE (2, 0, 2, 0)));
+    }
+
+    //[v0 x x v1] [x x v2 x] [x v3 x x]
+    __m128i first  = _mm_loadu_si128 ((const __m128i*) vals);
+    __m128i second = _mm_loadu_si128 ((const __m128i*) (vals + 4));
+    __m128i third  = _mm_loadu_si128 ((const __m128i*) (vals + 8));
+
+    __m128i first_vals = _mm_shuffle_epi32 (first,  _MM_SHUFFLE (3, 3, 3, 0));
+    __m128i last_vals  = _mm_unpacklo_epi32 (_mm_shuffle_epi32 (second, _MM_SHUFFLE (2, 2, 2, 2)),
+                                             _mm_shuffle_epi32 (third,  _MM_SHUFFLE (1, 1, 1, 1)));
+
+    return _mm_unpacklo_epi64 (first_vals, last_vals);
+}
+
+//======================================================================================
+
+__attribute__ ((target ("avx2")))
+static long Find_strided_avx2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    const __m256i key = _mm256_set1_epi32 (val);
+
+    //Only the values are gathered, so any stride of the node is scanned without reading past the last one
+    const int step = (int) stride;
+    const __m256i offsets = _mm256_setr_epi32 (0, step, 2 * step, 3 * step, 4 * step, 5 * step, 6 * step, 7 * step);
+
+    long it = 0;
+
+    for (; it + 8 <= cnt_vals; it += 8)
+    {
+        __m256i cur_vals = _mm256_i32gather_epi32 ((const int*) (vals + it * stride), offsets, sizeof (int32_t));
+
+        int mask = _mm256_movemask_ps (_mm256_castsi256_ps (_mm256_cmpeq_epi32 (cur_vals, key)));
+
+        if (mask) return it + __builtin_ctz ((unsigned) mask);
+    }
+
+    long tail_pos = Find_strided_scalar (vals + it * stride, cnt_vals - it, stride, val);
+
+    return (tail_pos >= 0) ? it + tail_pos : -1;
+}
+
+//======================================================================================
+
+__attribute__ ((target ("avx2")))
+static long Count_strided_avx2 (const int32_t *vals, const long cnt_vals, const long stride, const int32_t val)
+{
+    const __m256i key = _mm256_set1_epi32 (val);
+
+    const int step = (int) stride;
+    const __m256i offsets = _mm256_setr_epi32 (0, step, 2 * step, 3 * step, 4 * step, 5 * step, 6 * step, 7 * step);
+
+    long it = 0;
+    long cnt_equal = 0;
+
+    while (it + 8 <= cnt_vals)
+    {
+        __m256i lane_counters = _mm256_setzero_si256 ();
+
+        for (long block = 0; block < Max_count_block && it + 8 <= cnt_vals; block++, it += 8)
+        {
+            __m256i cur_vals = _mm256_i32gather_epi32 ((const int*) (vals + it * stride), offsets, sizeof (int32_t));
+
+            lane_counters = _mm256_sub_epi32 (lane_counters, _mm256_cmpeq_epi32 (cur_vals, key));
+        }
+
+        int32_t lanes[8] = {};
+        _mm256_storeu_si256 ((__m256i*) lanes, lane_counters);
+
+        for (int lane = 0; lane < 8; lane++)
+            cnt_equal += lanes[lane];
+    }
+
+    return cnt_equal + Count_strided_scalar (vals + it * stride, cnt_vals - it, stride, val);
+}
+
+#endif
+
+//======================================================================================
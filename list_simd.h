@@ -0,0 +1,29 @@
+#ifndef _LIST_SIMD_H_
+#define _LIST_SIMD_H_
+
+#include <stddef.h>
+
+#include "config_list.h"
+
+//Scans over arrays of values that lie at a fixed stride in memory: contiguous values of
+//LIST_SOA or values inside the Node structures. 32-bit integer values are compared by AVX2
+//or SSE2 chosen at runtime. Contiguous values are loaded directly. Values inside the nodes
+//are gathered by AVX2 at any stride, SSE2 shuffles them out of 8- and 12-byte nodes.
+//Other strides and types use the scalar loop.
+
+/**
+ * @brief Position of the first value equal to val
+ * @version 1.0.0
+ * @param [in] *vals The first value
+ * @param [in] cnt_vals Number of values
+ * @param [in] stride Bytes between neighbouring values
+ * @param [in] val The searched value
+ * @return Returns the position starting from 0, otherwise a negative number
+*/
+long Elems_find  (const elem_t *vals, const long cnt_vals, const size_t stride, const elem_t val);
+
+long Elems_count (const elem_t *vals, const long cnt_vals, const size_t stride, const elem_t val);
+
+const char* Elems_scan_isa ();      //<- Name of the instruction set chosen for scans of 32-bit values
+
+#endif  //#endif _LIST_SIMD_H_
@@ -0,0 +1,24 @@
+#include "list_template.h"
+
+//The templates are instantiated here, so every member is compiled with the flags of the project.
+//Member templates are instantiated for values passed by const reference and by move.
+
+#define INSTANTIATE_LIST_TPL(T, ...)                                                                        \
+                                                                                                            \
+    template class list_tpl::List<T, __VA_ARGS__>;                                                          \
+                                                                                                            \
+    template class list_tpl::List<T, __VA_ARGS__>::Iterator_base<list_tpl::List<T, __VA_ARGS__>, T>;        \
+    template class list_tpl::List<T, __VA_ARGS__>::Iterator_base<const list_tpl::List<T, __VA_ARGS__>,      \
+                                                                  const T>;                                 \
+                                                                                                            \
+    template long list_tpl::List<T, __VA_ARGS__>::insert_befor_ind<const T &> (const int ind, const T &val); \
+    template long list_tpl::List<T, __VA_ARGS__>::insert_front<const T &>     (const T &val);                \
+    template long list_tpl::List<T, __VA_ARGS__>::insert_back<const T &>      (const T &val);                \
+    template long list_tpl::List<T, __VA_ARGS__>::insert_back<T>              (T &&val);                     \
+    template int  list_tpl::List<T, __VA_ARGS__>::change_val<const T &>       (const int ind, const T &val);
+
+INSTANTIATE_LIST_TPL (int,    int)
+
+INSTANTIATE_LIST_TPL (double, int, list_tpl::List_release_policy)
+
+#undef INSTANTIATE_LIST_TPL
@@ -0,0 +1,741 @@
+#ifndef _LIST_TEMPLATE_H_
+#define _LIST_TEMPLATE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stddef.h>
+#include <limits.h>
+
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "list_codes.h"
+
+#include "src/log_info/log_errors.h"
+
+//Header-only List with the element type, the link type and the configuration as template
+//parameters. Semantics follow the List_* functions, error codes are taken from list_codes.h.
+//Lists of different element types can live in one program.
+
+namespace list_tpl
+{
+
+/**
+ * @brief Default configuration, compile-time analogue of config_list.h
+ * @note A policy is any type with the same static constexpr members
+*/
+struct List_default_policy
+{
+    static constexpr bool   Use_log       = true;               //<- Errors are written to the log file
+    static constexpr bool   Dump_nodes    = true;               //<- List dump prints node arrays
+
+    static constexpr int    Check_level   = LIST_CHECK_FULL;    //<- List_check_level: 0 - no checks, 1 - header, 2 and 3 - full walks
+
+    static constexpr double Growth_factor = 2.0;                //<- Capacity of a full list is multiplied by it
+};
+
+/**
+ * @brief Configuration without logs and checks, all of them are compiled out
+*/
+struct List_release_policy
+{
+    static constexpr bool   Use_log       = false;
+    static constexpr bool   Dump_nodes    = false;
+
+    static constexpr int    Check_level   = LIST_CHECK_OFF;
+
+    static constexpr double Growth_factor = 2.0;
+};
+
+
+template <typename T, typename IndexT = int, typename Policy = List_default_policy>
+class List
+{
+    static_assert (std::is_integral<IndexT>::value, "IndexT must be an integral type");
+    static_assert (alignof (T) <= alignof (max_align_t), "Over-aligned types are not supported");
+    static_assert (Policy::Growth_factor > 1, "Growth_factor must be greater than 1");
+
+    public:
+
+        typedef T      value_type;
+        typedef IndexT index_type;
+
+        static constexpr IndexT Dummy_element = 0;
+        static constexpr IndexT Free_node     = std::numeric_limits<IndexT>::max ();   //<- Written to prev of free nodes
+
+        static constexpr long Max_capacity =
+            ((unsigned long long) std::numeric_limits<IndexT>::max () - 1 > (unsigned long long) LONG_MAX / 2) ?
+             LONG_MAX / 2 : (long) std::numeric_limits<IndexT>::max () - 1;
+
+        //======================================================================================
+
+        explicit List (const long capacity = 1)
+        {
+            if (capacity <= 0 || capacity > Max_capacity)
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "Incorrectly entered capacity values: %ld\n", capacity);
+
+                capacity_ = -1;
+                return;
+            }
+
+            links_ = (Link*) calloc ((size_t) capacity + 1, sizeof (Link));
+            vals_  = (T*)    malloc (((size_t) capacity + 1) * sizeof (T));
+
+            if (links_ == nullptr || vals_ == nullptr)
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "Memory allocation error\n");
+
+                free (links_);
+                free (vals_);
+
+                links_    = nullptr;
+                vals_     = nullptr;
+                capacity_ = -1;
+                return;
+            }
+
+            capacity_ = capacity;
+        }
+
+        ~List ()
+        {
+            Destroy_vals ();
+
+            free (links_);
+            free (vals_);
+        }
+
+        List (const List &other) = delete;
+        List &operator= (const List &other) = delete;
+
+        List (List &&other) noexcept
+        {
+            Swap (other);
+        }
+
+        List &operator= (List &&other) noexcept
+        {
+            if (this != &other)
+                Swap (other);
+
+            return *this;
+        }
+
+        //======================================================================================
+
+        long   size          () const { return size_data_; }
+        long   capacity      () const { return capacity_;  }
+        bool   empty         () const { return size_data_ == 0; }
+        int    is_linearized () const { return is_linearized_; }
+
+        IndexT head () const { return links_[Dummy_element].next; }
+        IndexT tail () const { return links_[Dummy_element].prev; }
+
+        IndexT next (const IndexT ind) const { return links_[ind].next; }
+        IndexT prev (const IndexT ind) const { return links_[ind].prev; }
+
+        T       &operator[] (const IndexT ind)       { return vals_[ind]; }
+        const T &operator[] (const IndexT ind) const { return vals_[ind]; }
+
+        //======================================================================================
+
+        /**
+         * @brief Adds a node right after ind, as List_insert_befor_ind
+         * @return Returns the physical pointer of the added node, otherwise a negative number
+        */
+        template <typename U>
+        long insert_befor_ind (const IndexT ind, U &&val)
+        {
+            if (Check ("ENTRY\nFROM: insert_befor_ind")) return LIST_INSERT_ERR;
+
+            if (!Is_used (ind) && ind != Dummy_element)
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "Incorrect ind = %lld\n", (long long) ind);
+
+                return LIST_INSERT_ERR;
+            }
+
+            return Link_node (ind, std::forward<U> (val));
+        }
+
+        template <typename U>
+        long insert_front (U &&val)
+        {
+            if (Check ("ENTRY\nFROM: insert_front")) return LIST_INSERT_ERR;
+
+            return Link_node (Dummy_element, std::forward<U> (val));
+        }
+
+        template <typename U>
+        long insert_back (U &&val)
+        {
+            if (Check ("ENTRY\nFROM: insert_back")) return LIST_INSERT_ERR;
+
+            return Link_node (tail (), std::forward<U> (val));
+        }
+
+        //======================================================================================
+
+        int erase (const IndexT ind)
+        {
+            if (Check ("ENTRY\nFROM: erase")) return LIST_ERASE_ERR;
+
+            if (!Is_used (ind))
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "There is nothing at this pointer: %lld\n", (long long) ind);
+
+                return LIST_ERASE_ERR;
+            }
+
+            if (ind != head () && ind != tail ())
+                is_linearized_ = 0;
+
+            IndexT prev_ptr = links_[ind].prev;
+            IndexT next_ptr = links_[ind].next;
+
+            links_[prev_ptr].next = next_ptr;
+            links_[next_ptr].prev = prev_ptr;
+
+            vals_[ind].~T ();
+
+            Push_free_node (ind);
+
+            size_data_--;
+
+            if (size_data_ == 0)
+                is_linearized_ = 1;
+
+            if (Check ("EXIT\nFROM: erase")) return LIST_ERASE_ERR;
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        int clear ()
+        {
+            if (Check ("ENTRY\nFROM: clear")) return DATA_CLEAR_ERR;
+
+            Destroy_vals ();
+
+            links_[Dummy_element] = {Dummy_element, Dummy_element};
+
+            free_ptr_  = Dummy_element;
+            bump_ptr_  = 1;
+            size_data_ = 0;
+
+            is_linearized_ = 1;
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        /**
+         * @brief Puts the nodes in logical order to the physical indexes 1..size in place
+         * @note Trivially copyable values are swapped as bytes, the others are moved
+        */
+        int linearize ()
+        {
+            if (Check ("ENTRY\nFROM: linearize")) return LIST_LINEARIZE_ERR;
+
+            //A linearized list starting from the first node already has nodes in places
+            long cnt_moved = (is_linearized_ == 1 && head () == 1) ? 0 : size_data_;
+
+            IndexT logical_ind = head ();
+
+            for (long counter = 1; counter <= cnt_moved; counter++)
+            {
+                IndexT cur_ind = (IndexT) counter;
+
+                if (logical_ind != cur_ind)
+                    Move_node (cur_ind, logical_ind);
+
+                logical_ind = links_[cur_ind].next;
+            }
+
+            //All free nodes are after the tail now, so they are given to the unused region
+            free_ptr_ = Dummy_element;
+            bump_ptr_ = (IndexT) (size_data_ + 1);
+
+            is_linearized_ = 1;
+
+            if (Check ("EXIT\nFROM: linearize")) return LIST_LINEARIZE_ERR;
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        int reserve (const long cnt_nodes)
+        {
+            if (Check ("ENTRY\nFROM: reserve")) return LIST_RESIZE_ERR;
+
+            if (cnt_nodes < 0 || cnt_nodes + 1 > Max_capacity)
+                return LIST_RESIZE_ERR;
+
+            //One free node is always kept as in List_resize
+            if (capacity_ < cnt_nodes + 1)
+                return Recalloc (cnt_nodes + 1);
+
+            return 0;
+        }
+
+        int shrink_to_fit ()
+        {
+            if (linearize ()) return LIST_RESIZE_ERR;
+
+            if (capacity_ > size_data_ + 1)
+                return Recalloc (size_data_ + 1);
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        long get_ind_by_logical_order (const long pos) const
+        {
+            if (Check ("ENTRY\nFROM: get_ind_by_logical_order")) return GET_LOGICAL_PTR_ERR;
+
+            if (pos < 1 || pos > size_data_)
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "Number of elements of the requested index.\npos = %ld\n", pos);
+
+                return GET_LOGICAL_PTR_ERR;
+            }
+
+            if (is_linearized_)
+                return (long) head () + pos - 1;
+
+            IndexT logical_ind = head ();
+
+            for (long counter = 1; counter < pos; counter++)
+                logical_ind = links_[logical_ind].next;
+
+            return (long) logical_ind;
+        }
+
+        /**
+         * @return Returns the pointer to the value, nullptr if there is no value at ind
+        */
+        const T *get_val (const IndexT ind) const
+        {
+            if (Check ("ENTRY\nFROM: get_val")) return nullptr;
+
+            return Is_used (ind) ? vals_ + ind : nullptr;
+        }
+
+        template <typename U>
+        int change_val (const IndexT ind, U &&val)
+        {
+            if (Check ("ENTRY\nFROM: change_val")) return GET_VAL_ERR;
+
+            if (!Is_used (ind))
+                return GET_VAL_ERR;
+
+            vals_[ind] = std::forward<U> (val);
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        uint64_t verify () const
+        {
+            uint64_t err = 0;
+
+            if constexpr (Policy::Check_level > LIST_CHECK_OFF)
+            {
+                if (capacity_  < 0)                 err |= NEGATIVE_CAPAITY;
+                if (size_data_ < 0)                 err |= NEGATIVE_SIZE;
+                if (capacity_  < size_data_)        err |= CAPACITY_LOWER_SIZE;
+
+                if (links_ == nullptr || vals_ == nullptr)
+                    return err | DATA_IS_NULLPTR;
+
+                if ((long) bump_ptr_ <= 0 || (long) bump_ptr_ > capacity_ + 1 ||
+                    (long) free_ptr_ >= (long) bump_ptr_)
+                    err |= ILLIQUID_FREE_PTR;
+
+                if (links_[tail ()].next != Dummy_element) err |= ILLIQUID_TAIL_PTR;
+                if (links_[head ()].prev != Dummy_element) err |= ILLIQUID_HEAD_PTR;
+
+                if (is_linearized_ != 0 && is_linearized_ != 1) err |= INCORRECT_LINEARIZED;
+
+                if constexpr (Policy::Check_level >= LIST_CHECK_DIRTY)
+                {
+                    if (!err && Nodes_verifier ())      err |= DATA_NODE_INCORRECT;
+                    if (!err && Free_nodes_verifier ()) err |= DATA_FREE_NODE_INCORRECT;
+                }
+            }
+
+            return err;
+        }
+
+        int dump (const char *comment) const
+        {
+            if constexpr (Policy::Use_log)
+            {
+                FILE *fp_logs = Get_log_file_ptr ();
+
+                if (fp_logs == nullptr) return LIST_INVALID_ERR;
+
+                fprintf (fp_logs, "=================================================\n\n");
+                fprintf (fp_logs, "<h2>%s</h2>\n", comment);
+
+                uint64_t err = verify ();
+
+                fprintf (fp_logs, "%s\n", err ? "ERROR" : "OK");
+                fprintf (fp_logs, "size data: %ld, capacity: %ld, head: %lld, tail: %lld, "
+                                  "free: %lld, bump: %lld, is_linearized: %d, err: %llu\n",
+                                  size_data_, capacity_, (long long) head (), (long long) tail (),
+                                  (long long) free_ptr_, (long long) bump_ptr_, is_linearized_,
+                                  (unsigned long long) err);
+
+                if constexpr (Policy::Dump_nodes)
+                {
+                    if (links_ != nullptr && !(err & CAPACITY_LOWER_SIZE))
+                    {
+                        for (long it = 0; it < (long) bump_ptr_; it++)
+                        {
+                            fprintf (fp_logs, "%5ld: next %5lld prev %5lld",
+                                     it, (long long) links_[it].next, (long long) links_[it].prev);
+
+                            if constexpr (std::is_arithmetic<T>::value)
+                                if (it != Dummy_element && links_[it].prev != Free_node)
+                                    fprintf (fp_logs, " val %lg", (double) vals_[it]);
+
+                            fprintf (fp_logs, "\n");
+                        }
+                    }
+                }
+
+                fprintf (fp_logs, "==========================================================\n\n");
+            }
+            else
+                (void) comment;
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        template <typename List_type, typename Elem_type>
+        class Iterator_base
+        {
+            public:
+
+                typedef std::bidirectional_iterator_tag iterator_category;
+                typedef T                               value_type;
+                typedef ptrdiff_t                       difference_type;
+                typedef Elem_type*                      pointer;
+                typedef Elem_type&                      reference;
+
+                Iterator_base () {}
+
+                Iterator_base (List_type *list, const IndexT ind) : list_ (list), ind_ (ind) {}
+
+                reference operator*  () const { return  list_->vals_[ind_]; }
+                pointer   operator-> () const { return &list_->vals_[ind_]; }
+
+                Iterator_base &operator++ ()    { ind_ = list_->links_[ind_].next; return *this; }
+                Iterator_base &operator-- ()    { ind_ = list_->links_[ind_].prev; return *this; }
+
+                Iterator_base operator++ (int)  { Iterator_base old = *this; ++*this; return old; }
+                Iterator_base operator-- (int)  { Iterator_base old = *this; --*this; return old; }
+
+                bool operator== (const Iterator_base &other) const { return list_ == other.list_ && ind_ == other.ind_; }
+                bool operator!= (const Iterator_base &other) const { return !(*this == other); }
+
+                IndexT ind () const { return ind_; }
+
+            private:
+
+                List_type *list_ = nullptr;
+                IndexT ind_ = Dummy_element;
+        };
+
+        typedef Iterator_base<List, T>                   iterator;
+        typedef Iterator_base<const List, const T>       const_iterator;
+
+        iterator       begin ()       { return iterator       (this, head ()); }
+        iterator       end   ()       { return iterator       (this, Dummy_element); }
+        const_iterator begin () const { return const_iterator (this, head ()); }
+        const_iterator end   () const { return const_iterator (this, Dummy_element); }
+
+    private:
+
+        struct Link
+        {
+            IndexT next;
+            IndexT prev;
+        };
+
+        T    *vals_  = nullptr;     //<- Values are constructed only in not-free nodes
+        Link *links_ = nullptr;
+
+        long capacity_  = 0;
+        long size_data_ = 0;
+
+        IndexT free_ptr_ = Dummy_element;   //<- Top of the stack of recycled nodes, Dummy_element - empty
+        IndexT bump_ptr_ = 1;               //<- Nodes in [bump_ptr_, capacity_] have not been used
+
+        int is_linearized_ = 1;
+
+        //======================================================================================
+
+        int Check (const char *comment) const
+        {
+            if constexpr (Policy::Check_level > LIST_CHECK_OFF)
+            {
+                if (verify ())
+                {
+                    dump (comment);
+
+                    if constexpr (Policy::Use_log)
+                        Err_report_ (LOG_ARGS);
+
+                    return 1;
+                }
+            }
+            else
+                (void) comment;
+
+            return 0;
+        }
+
+        bool Is_used (const IndexT ind) const
+        {
+            return ind != Dummy_element && (long) ind < (long) bump_ptr_ &&
+                   (long) ind <= capacity_ && links_[ind].prev != Free_node;
+        }
+
+        //======================================================================================
+
+        template <typename U>
+        long Link_node (const IndexT prev_ptr, U &&val)
+        {
+            if (capacity_ == size_data_ + 1)
+            {
+                long new_capacity = (long) ((double) capacity_ * Policy::Growth_factor) + 1;
+
+                if (new_capacity > Max_capacity) new_capacity = Max_capacity;
+
+                if (new_capacity <= capacity_ || Recalloc (new_capacity))
+                    return LIST_INSERT_ERR;
+            }
+
+            IndexT cur_ptr  = Pop_free_node ();
+            IndexT next_ptr = links_[prev_ptr].next;
+
+            ::new ((void*) (vals_ + cur_ptr)) T (std::forward<U> (val));
+
+            links_[cur_ptr]  = {next_ptr, prev_ptr};
+            links_[prev_ptr].next = cur_ptr;
+            links_[next_ptr].prev = cur_ptr;
+
+            //The node keeps the list linearized only if it continues the physical order
+            if (size_data_ == 0)
+                is_linearized_ = 1;
+            else if (!(next_ptr == Dummy_element && cur_ptr == (IndexT) (prev_ptr + 1)))
+                is_linearized_ = 0;
+
+            size_data_++;
+
+            if (Check ("EXIT\nFROM: Link_node")) return LIST_INSERT_ERR;
+
+            return (long) cur_ptr;
+        }
+
+        IndexT Pop_free_node ()
+        {
+            if (free_ptr_ != Dummy_element)
+            {
+                IndexT cur_ptr = free_ptr_;
+                free_ptr_ = links_[cur_ptr].next;
+
+                return cur_ptr;
+            }
+
+            return bump_ptr_++;
+        }
+
+        void Push_free_node (const IndexT ind)
+        {
+            links_[ind] = {free_ptr_, Free_node};
+            free_ptr_   = ind;
+        }
+
+        //======================================================================================
+
+        void Move_node (const IndexT to_ind, const IndexT from_ind)
+        {
+            if (links_[to_ind].prev == Free_node)
+            {
+                //The free stack is rebuilt by the caller
+                ::new ((void*) (vals_ + to_ind)) T (std::move (vals_[from_ind]));
+                vals_[from_ind].~T ();
+
+                links_[to_ind]   = links_[from_ind];
+                links_[from_ind] = {Dummy_element, Free_node};
+            }
+            else
+            {
+                if constexpr (std::is_trivially_copyable<T>::value)
+                {
+                    unsigned char tmp_val[sizeof (T)] = {};
+
+                    memcpy (tmp_val,           vals_ + to_ind,   sizeof (T));
+                    memcpy ((void*) (vals_ + to_ind),   vals_ + from_ind, sizeof (T));
+                    memcpy ((void*) (vals_ + from_ind), tmp_val,          sizeof (T));
+                }
+                else
+                {
+                    using std::swap;
+                    swap (vals_[to_ind], vals_[from_ind]);
+                }
+
+                Link tmp_link     = links_[to_ind];
+                links_[to_ind]    = links_[from_ind];
+                links_[from_ind]  = tmp_link;
+
+                //Neighbouring nodes point to themselves after the swap
+                if (links_[to_ind].next   == to_ind)   links_[to_ind].next   = from_ind;
+                if (links_[to_ind].prev   == to_ind)   links_[to_ind].prev   = from_ind;
+
+                if (links_[from_ind].next == from_ind) links_[from_ind].next = to_ind;
+                if (links_[from_ind].prev == from_ind) links_[from_ind].prev = to_ind;
+
+                links_[links_[from_ind].prev].next = from_ind;
+                links_[links_[from_ind].next].prev = from_ind;
+            }
+
+            links_[links_[to_ind].prev].next = to_ind;
+            links_[links_[to_ind].next].prev = to_ind;
+        }
+
+        //======================================================================================
+
+        int Recalloc (const long new_capacity)
+        {
+            if (new_capacity <= size_data_ || (new_capacity < capacity_ && (long) bump_ptr_ > new_capacity + 1))
+            {
+                if constexpr (Policy::Use_log)
+                    Log_report_ (LOG_ARGS, "The list is not subject to recalloc, new_capacity = %ld\n", new_capacity);
+
+                return LIST_RECALLOC_ERR;
+            }
+
+            Link *new_links = (Link*) realloc (links_, ((size_t) new_capacity + 1) * sizeof (Link));
+
+            if (new_links == nullptr)
+                return LIST_RECALLOC_ERR;
+
+            links_ = new_links;
+
+            T *new_vals = nullptr;
+
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                //Values are moved as bytes
+                new_vals = (T*) realloc ((void*) vals_, ((size_t) new_capacity + 1) * sizeof (T));
+
+                if (new_vals == nullptr)
+                    return LIST_RECALLOC_ERR;
+            }
+            else
+            {
+                new_vals = (T*) malloc (((size_t) new_capacity + 1) * sizeof (T));
+
+                if (new_vals == nullptr)
+                    return LIST_RECALLOC_ERR;
+
+                for (IndexT it = head (); it != Dummy_element; it = links_[it].next)
+                {
+                    ::new ((void*) (new_vals + it)) T (std::move (vals_[it]));
+                    vals_[it].~T ();
+                }
+
+                free (vals_);
+            }
+
+            vals_     = new_vals;
+            capacity_ = new_capacity;
+
+            return 0;
+        }
+
+        //======================================================================================
+
+        void Destroy_vals ()
+        {
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                if (links_ == nullptr || vals_ == nullptr) return;
+
+                for (IndexT it = head (); it != Dummy_element; it = links_[it].next)
+                    vals_[it].~T ();
+            }
+        }
+
+        void Swap (List &other)
+        {
+            std::swap (vals_,          other.vals_);
+            std::swap (links_,         other.links_);
+            std::swap (capacity_,      other.capacity_);
+            std::swap (size_data_,     other.size_data_);
+            std::swap (free_ptr_,      other.free_ptr_);
+            std::swap (bump_ptr_,      other.bump_ptr_);
+            std::swap (is_linearized_, other.is_linearized_);
+        }
+
+        //======================================================================================
+
+        int Nodes_verifier () const
+        {
+            IndexT logical_ind = Dummy_element;
+
+            for (long counter = 0; counter <= size_data_; counter++)
+            {
+                if ((long) logical_ind >= (long) bump_ptr_)    return 1;
+                if (links_[logical_ind].prev == Free_node)     return 1;
+
+                if (links_[links_[logical_ind].next].prev != logical_ind) return 1;
+
+                logical_ind = links_[logical_ind].next;
+            }
+
+            return logical_ind != Dummy_element;
+        }
+
+        int Free_nodes_verifier () const
+        {
+            IndexT free_ind = free_ptr_;
+
+            long cnt_free_nodes = capacity_ - size_data_ - (capacity_ - (long) bump_ptr_ + 1);
+
+            for (long counter = 0; counter < cnt_free_nodes; counter++)
+            {
+                if (free_ind == Dummy_element || (long) free_ind >= (long) bump_ptr_) return 1;
+                if (links_[free_ind].prev != Free_node)                                return 1;
+
+                free_ind = links_[free_ind].next;
+            }
+
+            return free_ind != Dummy_element;
+        }
+};
+
+}   //namespace list_tpl
+
+#endif  //#endif _LIST_TEMPLATE_H_
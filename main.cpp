@@ -34,9 +34,7 @@ int main ()
 
     List_dump (&list, "FROM MAIN");
 
-    for (int i = 21; i >= 4; i--){
-        List_erase (&list, i);
-    }
+    List_erase_range (&list, 4, 21);
 
     List_dump (&list, "FROM MAIN");
 
@@ -0,0 +1,680 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unrolled_list.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+
+static link_t Unrolled_new_chunk  (Unrolled_list *list, const link_t prev_ptr);
+
+static void   Unrolled_free_chunk (Unrolled_list *list, const link_t ind);
+
+static link_t Unrolled_split_chunk (Unrolled_list *list, const link_t ind);
+
+static void   Unrolled_merge_chunks (Unrolled_list *list, const link_t ind);
+
+static int Unrolled_insert_at (Unrolled_list *list, const Unrolled_pos *unrolled_pos, const elem_t val);
+
+static int Unrolled_list_recalloc (Unrolled_list *list, const long new_capacity);
+
+static int Unrolled_chunks_verifier      (const Unrolled_list *list);
+
+static int Unrolled_free_chunks_verifier (const Unrolled_list *list);
+
+#define REPORT(...)                                         \
+    {                                                       \
+        Unrolled_list_dump (list, __VA_ARGS__);             \
+        Err_report ();                                      \
+                                                            \
+    }while (0)
+
+#if LIST_CHECK_LEVEL > 0
+
+    #define Check_unrolled_list(list)                       \
+            Unrolled_list_verify (list)
+
+#else
+
+    #define Check_unrolled_list(list) 0
+
+#endif
+
+//======================================================================================
+
+int Unrolled_list_ctor (Unrolled_list *list, const long capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (capacity <= 0 || capacity > Max_list_capacity)
+    {
+        Log_report ("Incorrectly entered capacity values: %ld\n", capacity);
+        Err_report ();
+
+        return UNROLLED_LIST_CTOR_ERR;
+    }
+
+    list->data = (Chunk*) calloc ((size_t) capacity + 1, sizeof (Chunk));
+
+    if (Check_nullptr (list->data))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+
+        return UNROLLED_LIST_CTOR_ERR;
+    }
+
+    list->capacity   = capacity;
+    list->size_data  = 0;
+    list->cnt_chunks = 0;
+
+    list->head_ptr = Dummy_element;
+    list->tail_ptr = Dummy_element;
+    list->free_ptr = Identifier_free_node;
+    list->bump_ptr = 1;                         //<- Chunks are not initialized until they are used
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("EXIT\nFROM: Unrolled_list_ctor\n");
+        return UNROLLED_LIST_CTOR_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int Unrolled_list_dtor (Unrolled_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Unrolled_list_dtor\n");
+        return UNROLLED_LIST_DTOR_ERR;
+    }
+
+    free (list->data);
+    list->data = nullptr;
+
+    list->head_ptr = Poison_ptr;
+    list->tail_ptr = Poison_ptr;
+    list->free_ptr = Poison_ptr;
+    list->bump_ptr = Poison_ptr;
+
+    list->size_data  = -1;
+    list->capacity   = -1;
+    list->cnt_chunks = -1;
+
+    return 0;
+}
+
+//======================================================================================
+
+static link_t Unrolled_new_chunk (Unrolled_list *list, const link_t prev_ptr)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (list->free_ptr == Identifier_free_node && list->bump_ptr > list->capacity)
+    {
+        double new_capacity = (double) list->capacity * LIST_GROWTH_FACTOR + 1;
+
+        if (Unrolled_list_recalloc (list, (new_capacity < (double) Max_list_capacity) ?
+                                          (long) new_capacity : Max_list_capacity))
+        {
+            Log_report ("Recalloc error\n");
+            return UNROLLED_LIST_RECALLOC_ERR;
+        }
+    }
+
+    link_t cur_ptr = Dummy_element;
+
+    if (list->free_ptr != Identifier_free_node)
+    {
+        cur_ptr = list->free_ptr;
+        list->free_ptr = list->data[cur_ptr].next;
+    }
+    else
+        cur_ptr = list->bump_ptr++;
+
+    link_t next_ptr = (prev_ptr == Dummy_element) ? list->head_ptr : list->data[prev_ptr].next;
+
+    list->data[cur_ptr].cnt_vals = 0;
+    list->data[cur_ptr].next     = next_ptr;
+    list->data[cur_ptr].prev     = prev_ptr;
+
+    if (prev_ptr == Dummy_element) list->head_ptr = cur_ptr;
+    else                           list->data[prev_ptr].next = cur_ptr;
+
+    if (next_ptr == Dummy_element) list->tail_ptr = cur_ptr;
+    else                           list->data[next_ptr].prev = cur_ptr;
+
+    list->cnt_chunks++;
+
+    return cur_ptr;
+}
+
+//======================================================================================
+
+static void Unrolled_free_chunk (Unrolled_list *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    link_t prev_ptr = list->data[ind].prev;
+    link_t next_ptr = list->data[ind].next;
+
+    if (prev_ptr == Dummy_element) list->head_ptr = next_ptr;
+    else                           list->data[prev_ptr].next = next_ptr;
+
+    if (next_ptr == Dummy_element) list->tail_ptr = prev_ptr;
+    else                           list->data[next_ptr].prev = prev_ptr;
+
+    list->data[ind].cnt_vals = 0;
+    list->data[ind].next     = list->free_ptr;
+    list->data[ind].prev     = Identifier_free_node;
+
+    list->free_ptr = ind;
+
+    list->cnt_chunks--;
+
+    return;
+}
+
+//======================================================================================
+
+static link_t Unrolled_split_chunk (Unrolled_list *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    link_t new_ptr = Unrolled_new_chunk (list, ind);
+
+    if (new_ptr < 0) return new_ptr;
+
+    //The upper half of the values is moved to the new chunk
+    Chunk *chunk     = list->data + ind;
+    Chunk *new_chunk = list->data + new_ptr;
+
+    int cnt_left = chunk->cnt_vals / 2;
+
+    new_chunk->cnt_vals = chunk->cnt_vals - cnt_left;
+    memcpy (new_chunk->vals, chunk->vals + cnt_left, (size_t) new_chunk->cnt_vals * sizeof (elem_t));
+
+    chunk->cnt_vals = cnt_left;
+
+    return new_ptr;
+}
+
+//======================================================================================
+
+static void Unrolled_merge_chunks (Unrolled_list *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    Chunk *chunk = list->data + ind;
+
+    if (chunk->cnt_vals == 0)
+    {
+        Unrolled_free_chunk (list, ind);
+        return;
+    }
+
+    link_t next_ptr = chunk->next;
+    link_t prev_ptr = chunk->prev;
+
+    if (next_ptr != Dummy_element && chunk->cnt_vals + list->data[next_ptr].cnt_vals <= Chunk_capacity)
+    {
+        memcpy (chunk->vals + chunk->cnt_vals, list->data[next_ptr].vals,
+                (size_t) list->data[next_ptr].cnt_vals * sizeof (elem_t));
+
+        chunk->cnt_vals += list->data[next_ptr].cnt_vals;
+
+        Unrolled_free_chunk (list, next_ptr);
+    }
+
+    else if (prev_ptr != Dummy_element && chunk->cnt_vals + list->data[prev_ptr].cnt_vals <= Chunk_capacity)
+    {
+        Chunk *prev_chunk = list->data + prev_ptr;
+
+        memcpy (prev_chunk->vals + prev_chunk->cnt_vals, chunk->vals, (size_t) chunk->cnt_vals * sizeof (elem_t));
+
+        prev_chunk->cnt_vals += chunk->cnt_vals;
+
+        Unrolled_free_chunk (list, ind);
+    }
+
+    return;
+}
+
+//======================================================================================
+
+static int Unrolled_insert_at (Unrolled_list *list, const Unrolled_pos *unrolled_pos, const elem_t val)
+{
+    assert (list         != nullptr && "list is nullptr");
+    assert (unrolled_pos != nullptr && "unrolled_pos is nullptr");
+
+    link_t chunk_ptr = unrolled_pos->chunk;
+    int    offset    = unrolled_pos->offset;
+
+    if (list->data[chunk_ptr].cnt_vals == Chunk_capacity)
+    {
+        link_t new_ptr = Unrolled_split_chunk (list, chunk_ptr);
+
+        if (new_ptr < 0) return UNROLLED_LIST_INSERT_ERR;
+
+        if (offset > list->data[chunk_ptr].cnt_vals)
+        {
+            offset   -= list->data[chunk_ptr].cnt_vals;
+            chunk_ptr = new_ptr;
+        }
+    }
+
+    Chunk *chunk = list->data + chunk_ptr;
+
+    memmove (chunk->vals + offset + 1, chunk->vals + offset, (size_t) (chunk->cnt_vals - offset) * sizeof (elem_t));
+
+    chunk->vals[offset] = val;
+    chunk->cnt_vals++;
+
+    list->size_data++;
+
+    return 0;
+}
+
+//======================================================================================
+
+int Unrolled_list_insert (Unrolled_list *list, const long pos, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Unrolled_list_insert, pos = %ld, val = %d\n", pos, val);
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    if (pos < 0 || pos > list->size_data)
+    {
+        Log_report ("Incorrect pos = %ld, size_data = %ld\n", pos, list->size_data);
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    Unrolled_pos unrolled_pos = {};
+
+    if (list->size_data == 0)
+    {
+        unrolled_pos.chunk = Unrolled_new_chunk (list, Dummy_element);
+
+        if (unrolled_pos.chunk < 0)
+        {
+            Log_report ("New chunk error\n");
+            Err_report ();
+            return UNROLLED_LIST_INSERT_ERR;
+        }
+    }
+
+    //The value is put after the value pos, so its chunk is found for pos + 1 without the last offset
+    else if (pos == 0)
+        unrolled_pos.chunk = list->head_ptr;
+
+    else
+    {
+        Unrolled_get_pos_by_logical_order (list, pos, &unrolled_pos);
+        unrolled_pos.offset++;
+    }
+
+    if (Unrolled_insert_at (list, &unrolled_pos, val))
+    {
+        Log_report ("Insert error, pos = %ld\n", pos);
+        Err_report ();
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("EXIT\nFROM: Unrolled_list_insert, pos = %ld, val = %d\n", pos, val);
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int Unrolled_list_insert_front (Unrolled_list *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return Unrolled_list_insert (list, 0, val);
+}
+
+//======================================================================================
+
+int Unrolled_list_insert_back (Unrolled_list *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Unrolled_list_insert_back, val = %d\n", val);
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    //A full tail is not split, so appended values fill whole chunks
+    link_t chunk_ptr = list->tail_ptr;
+
+    if (chunk_ptr == Dummy_element || list->data[chunk_ptr].cnt_vals == Chunk_capacity)
+        chunk_ptr = Unrolled_new_chunk (list, list->tail_ptr);
+
+    if (chunk_ptr < 0)
+    {
+        Log_report ("New chunk error, val = %d\n", val);
+        Err_report ();
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    Chunk *chunk = list->data + chunk_ptr;
+
+    chunk->vals[chunk->cnt_vals++] = val;
+
+    list->size_data++;
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("EXIT\nFROM: Unrolled_list_insert_back, val = %d\n", val);
+        return UNROLLED_LIST_INSERT_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int Unrolled_list_erase (Unrolled_list *list, const long pos)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Unrolled_list_erase, pos = %ld\n", pos);
+        return UNROLLED_LIST_ERASE_ERR;
+    }
+
+    Unrolled_pos unrolled_pos = {};
+
+    if (Unrolled_get_pos_by_logical_order (list, pos, &unrolled_pos))
+    {
+        Log_report ("There is nothing at this position: %ld\n", pos);
+        return UNROLLED_LIST_ERASE_ERR;
+    }
+
+    Chunk *chunk = list->data + unrolled_pos.chunk;
+
+    memmove (chunk->vals + unrolled_pos.offset, chunk->vals + unrolled_pos.offset + 1,
+             (size_t) (chunk->cnt_vals - unrolled_pos.offset - 1) * sizeof (elem_t));
+
+    chunk->cnt_vals--;
+
+    list->size_data--;
+
+    Unrolled_merge_chunks (list, unrolled_pos.chunk);
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("EXIT\nFROM: Unrolled_list_erase, pos = %ld\n", pos);
+        return UNROLLED_LIST_ERASE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Unrolled_list_recalloc (Unrolled_list *list, const long new_capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (new_capacity <= list->capacity || new_capacity > Max_list_capacity)
+    {
+        Log_report ("The list is not subject to recalloc, new_capacity = %ld\n", new_capacity);
+        return UNROLLED_LIST_RECALLOC_ERR;
+    }
+
+    Chunk *new_data = (Chunk*) realloc (list->data, ((size_t) new_capacity + 1) * sizeof (Chunk));
+
+    if (Check_nullptr (new_data))
+    {
+        Log_report ("Memory reallocation error, new_capacity = %ld\n", new_capacity);
+        return UNROLLED_LIST_RECALLOC_ERR;
+    }
+
+    //New chunks continue the unused region [bump_ptr, capacity]
+    list->data     = new_data;
+    list->capacity = new_capacity;
+
+    return 0;
+}
+
+//======================================================================================
+
+int Unrolled_get_pos_by_logical_order (const Unrolled_list *list, const long pos, Unrolled_pos *unrolled_pos)
+{
+    assert (list         != nullptr && "list is nullptr");
+    assert (unrolled_pos != nullptr && "unrolled_pos is nullptr");
+
+    if (pos < 1 || pos > list->size_data)
+    {
+        Log_report ("Number of elements of the requested index.\npos = %ld\n", pos);
+        return UNROLLED_GET_POS_ERR;
+    }
+
+    //Whole chunks are skipped from the nearest end of the list
+    if (pos <= list->size_data / 2)
+    {
+        link_t chunk_ptr = list->head_ptr;
+        long   cur_pos   = pos;
+
+        while (cur_pos > list->data[chunk_ptr].cnt_vals)
+        {
+            cur_pos  -= list->data[chunk_ptr].cnt_vals;
+            chunk_ptr = list->data[chunk_ptr].next;
+        }
+
+        unrolled_pos->chunk  = chunk_ptr;
+        unrolled_pos->offset = (int) cur_pos - 1;
+    }
+
+    else
+    {
+        link_t chunk_ptr = list->tail_ptr;
+        long   cur_pos   = list->size_data - pos;      //<- Number of values after the found one
+
+        while (cur_pos >= list->data[chunk_ptr].cnt_vals)
+        {
+            cur_pos  -= list->data[chunk_ptr].cnt_vals;
+            chunk_ptr = list->data[chunk_ptr].prev;
+        }
+
+        unrolled_pos->chunk  = chunk_ptr;
+        unrolled_pos->offset = list->data[chunk_ptr].cnt_vals - (int) cur_pos - 1;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+elem_t Unrolled_list_get_val (const Unrolled_list *list, const long pos)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_unrolled_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Unrolled_list_get_val, pos = %ld\n", pos);
+        return Poison_val;
+    }
+
+    Unrolled_pos unrolled_pos = {};
+
+    if (Unrolled_get_pos_by_logical_order (list, pos, &unrolled_pos))
+        return Poison_val;
+
+    return list->data[unrolled_pos.chunk].vals[unrolled_pos.offset];
+}
+
+//======================================================================================
+
+uint64_t Unrolled_list_verify (const Unrolled_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    int check_level = List_get_check_level ();
+
+    uint64_t err = 0;
+
+    if (check_level == LIST_CHECK_OFF) return 0;
+
+    if (list->capacity  < 0)                    err |= NEGATIVE_CAPAITY;
+    if (list->size_data < 0)                    err |= NEGATIVE_SIZE;
+    if (list->capacity  < list->cnt_chunks)     err |= CAPACITY_LOWER_SIZE;
+
+    if (list->cnt_chunks * Chunk_capacity < list->size_data) err |= CAPACITY_LOWER_SIZE;
+
+    if (list->data == nullptr)                  return err | DATA_IS_NULLPTR;
+
+    if (list->free_ptr <  Identifier_free_node  ||
+        list->free_ptr == Dummy_element         ||
+        list->free_ptr >= list->bump_ptr          ) err |= ILLIQUID_FREE_PTR;
+
+    if (list->bump_ptr <= Dummy_element         ||
+        list->bump_ptr >  list->capacity + 1      ) err |= ILLIQUID_FREE_PTR;
+
+    if (list->head_ptr < Dummy_element || list->head_ptr >= list->bump_ptr) err |= ILLIQUID_HEAD_PTR;
+    if (list->tail_ptr < Dummy_element || list->tail_ptr >= list->bump_ptr) err |= ILLIQUID_TAIL_PTR;
+
+    if (check_level >= LIST_CHECK_FULL && !err)
+    {
+        if (Unrolled_chunks_verifier      (list)) err |= DATA_NODE_INCORRECT;
+        if (Unrolled_free_chunks_verifier (list)) err |= DATA_FREE_NODE_INCORRECT;
+    }
+
+    return err;
+}
+
+//======================================================================================
+
+static int Unrolled_chunks_verifier (const Unrolled_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    link_t chunk_ptr = list->head_ptr;
+    link_t prev_ptr  = Dummy_element;
+
+    long cnt_vals = 0;
+
+    for (long counter = 0; counter < list->cnt_chunks; counter++)
+    {
+        if (chunk_ptr <= Dummy_element || chunk_ptr >= list->bump_ptr) return 1;
+
+        const Chunk *chunk = list->data + chunk_ptr;
+
+        if (chunk->prev != prev_ptr)                                return 1;
+        if (chunk->cnt_vals <= 0 || chunk->cnt_vals > Chunk_capacity) return 1;
+
+        cnt_vals += chunk->cnt_vals;
+
+        prev_ptr  = chunk_ptr;
+        chunk_ptr = chunk->next;
+    }
+
+    return chunk_ptr != Dummy_element || prev_ptr != list->tail_ptr || cnt_vals != list->size_data;
+}
+
+//======================================================================================
+
+static int Unrolled_free_chunks_verifier (const Unrolled_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long cnt_free_chunks = list->bump_ptr - 1 - list->cnt_chunks;     //<- Recycled chunks only
+
+    link_t free_ind = list->free_ptr;
+
+    for (long counter = 0; counter < cnt_free_chunks; counter++)
+    {
+        if (free_ind <= Dummy_element || free_ind >= list->bump_ptr) return 1;
+
+        if (list->data[free_ind].prev != Identifier_free_node) return 1;
+
+        free_ind = list->data[free_ind].next;
+    }
+
+    return free_ind != Identifier_free_node;
+}
+
+//======================================================================================
+
+int Unrolled_list_dump_ (const Unrolled_list *list,
+                         const char* file_name, const char* func_name, int line, const char *format, ...)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    uint64_t err = Unrolled_list_verify (list);
+
+    FILE *fp_logs = Get_log_file_ptr ();
+
+    fprintf (fp_logs, "=================================================\n\n");
+
+    va_list args;
+
+    va_start(args, format);
+    fprintf (fp_logs, "<h2>");
+    vfprintf(fp_logs, format, args);
+    fprintf (fp_logs, "</h2>");
+    va_end(args);
+
+    fprintf (fp_logs, "REFERENCE:\n");
+
+    if (err)
+        fprintf (fp_logs, "ERROR\nCaused an error in file %s, function %s, line %d\n\n", LOG_VAR);
+    else
+        fprintf (fp_logs, "OK\nlast call in file %s, function %s, line %d\n\n", LOG_VAR);
+
+    if (err)
+    {
+        fprintf (fp_logs, "ERR CODE: ");
+        Bin_represent (fp_logs, err, sizeof (err));
+        fprintf (fp_logs, "\n");
+    }
+
+    fprintf (fp_logs, "size data: %ld, capacity: %ld, cnt chunks: %ld, chunk capacity: %d\n",
+                       list->size_data, list->capacity, list->cnt_chunks, Chunk_capacity);
+
+    fprintf (fp_logs, "head: %" LINK_T_SPEC ", tail: %" LINK_T_SPEC ", free: %" LINK_T_SPEC ", bump: %" LINK_T_SPEC "\n\n",
+                       list->head_ptr, list->tail_ptr, list->free_ptr, list->bump_ptr);
+
+    if (list->data != nullptr && !err)
+    {
+        for (link_t it = 1; it < list->bump_ptr; it++)
+        {
+            const Chunk *chunk = list->data + it;
+
+            fprintf (fp_logs, "%5" LINK_T_SPEC ": next %5" LINK_T_SPEC " prev %5" LINK_T_SPEC " |",
+                               it, chunk->next, chunk->prev);
+
+            for (int ip = 0; ip < chunk->cnt_vals; ip++)
+                fprintf (fp_logs, " %d", chunk->vals[ip]);
+
+            fprintf (fp_logs, "\n");
+        }
+    }
+
+    fprintf (fp_logs, "==========================================================\n\n");
+
+    return 0;
+}
+
+//======================================================================================
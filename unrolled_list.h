@@ -0,0 +1,122 @@
+#ifndef _UNROLLED_LIST_H_
+#define _UNROLLED_LIST_H_
+
+#include <stdint.h>
+
+#include "list.h"
+
+//Unrolled list: every node is a chunk of up to Chunk_capacity values in logical order.
+//Chunks are split when they overflow and merged with the next chunk when they fit into one,
+//so a walk over the list takes about one cache miss per chunk instead of one per value.
+
+const int Chunk_capacity = (int) ((LIST_CHUNK_BYTES - sizeof (int) - 2 * sizeof (link_t)) / sizeof (elem_t));
+
+static_assert (Chunk_capacity >= 2, "LIST_CHUNK_BYTES is too small for two values");
+
+struct Chunk
+{
+    elem_t vals[Chunk_capacity] = {};
+
+    int cnt_vals = 0;
+
+    link_t next = 0;
+    link_t prev = 0;        //<- Identifier_free_node in free chunks
+};
+
+struct Unrolled_list
+{
+    long capacity       = 0;    //<- Number of chunks
+    long size_data      = 0;    //<- Number of values
+    long cnt_chunks     = 0;
+
+    Chunk *data = nullptr;
+
+    link_t head_ptr = 0;
+    link_t tail_ptr = 0;
+    link_t free_ptr = 0;        //<- Top of the stack of recycled chunks
+    link_t bump_ptr = 0;        //<- Chunks in [bump_ptr, capacity] have not been used since Unrolled_list_ctor
+};
+
+struct Unrolled_pos
+{
+    link_t chunk  = Dummy_element;
+    int    offset = 0;          //<- Index of the value in the chunk
+};
+
+
+enum Unrolled_list_func_err
+{
+    UNROLLED_LIST_CTOR_ERR      = -1,
+    UNROLLED_LIST_DTOR_ERR      = -2,
+
+    UNROLLED_LIST_INSERT_ERR    = -3,
+    UNROLLED_LIST_ERASE_ERR     = -4,
+
+    UNROLLED_LIST_RECALLOC_ERR  = -5,
+
+    UNROLLED_GET_POS_ERR        = -6,
+};
+
+
+/**
+ * @brief Unrolled_list constructor
+ * @version 1.0.0
+ * @param [in] *list Structure Unrolled_list pointer
+ * @param [in] capacity Number of chunks
+ * @return Returns zero if the list is constructed, otherwise returns a non-zero number
+*/
+int Unrolled_list_ctor (Unrolled_list *list, const long capacity);
+
+int Unrolled_list_dtor (Unrolled_list *list);
+
+
+/**
+ * @brief Adds a value so that it gets the logical order pos + 1
+ * @version 1.0.0
+ * @param [in] *list Structure Unrolled_list pointer
+ * @param [in] pos Number of values before the added one, from 0 to size_data
+ * @param [in] val The value
+ * @return Returns zero if the value is added, otherwise returns a non-zero number
+ * @note A full chunk is split in halves
+*/
+int Unrolled_list_insert (Unrolled_list *list, const long pos, const elem_t val);
+
+int Unrolled_list_insert_front (Unrolled_list *list, const elem_t val);
+
+int Unrolled_list_insert_back  (Unrolled_list *list, const elem_t val);
+
+/**
+ * @brief Removes the value with the logical order pos
+ * @version 1.0.0
+ * @param [in] *list Structure Unrolled_list pointer
+ * @param [in] pos Logical order of the value, starting from 1
+ * @return Returns zero if the value is deleted, otherwise returns a non-zero number
+ * @note The chunk is merged with a neighbour if their values fit into one chunk
+*/
+int Unrolled_list_erase (Unrolled_list *list, const long pos);
+
+/**
+ * @brief Position of the value by its logical order, whole chunks are skipped
+ * @version 1.0.0
+ * @param [in] *list Structure Unrolled_list pointer
+ * @param [in] pos Logical order of the value, starting from 1
+ * @param [out] *unrolled_pos Chunk and offset of the value
+ * @return Returns zero if the value is found, otherwise returns a non-zero number
+*/
+int Unrolled_get_pos_by_logical_order (const Unrolled_list *list, const long pos, Unrolled_pos *unrolled_pos);
+
+/**
+ * @brief Get value by its logical order
+ * @return Returns a poison value if an error has occurred, otherwise the value
+*/
+elem_t Unrolled_list_get_val (const Unrolled_list *list, const long pos);
+
+
+uint64_t Unrolled_list_verify (const Unrolled_list *list);
+
+#define Unrolled_list_dump(list, ...)                       \
+        Unrolled_list_dump_ (list, LOG_ARGS, __VA_ARGS__)
+
+int Unrolled_list_dump_ (const Unrolled_list *list, LOG_PARAMETS, const char *format, ...);
+
+#endif  //#endif _UNROLLED_LIST_H_
@@ -0,0 +1,592 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "xor_list.h"
+
+#include "src/log_info/log_errors.h"
+#include "src/Generals_func/generals.h"
+
+
+static link_t Xor_list_pop_free_node  (Xor_list *list);
+
+static void   Xor_list_push_free_node (Xor_list *list, const link_t ind);
+
+static link_t Xor_list_link_node (Xor_list *list, const link_t prev_ptr, const link_t next_ptr, const elem_t val);
+
+static int Xor_list_recalloc (Xor_list *list, const long new_capacity);
+
+static int Xor_list_nodes_verifier      (const Xor_list *list);
+
+static int Xor_list_free_nodes_verifier (const Xor_list *list);
+
+#define REPORT(...)                                         \
+    {                                                       \
+        Xor_list_dump (list, __VA_ARGS__);                  \
+        Err_report ();                                      \
+                                                            \
+    }while (0)
+
+#if LIST_CHECK_LEVEL > 0
+
+    #define Check_xor_list(list)                            \
+            Xor_list_verify (list)
+
+#else
+
+    #define Check_xor_list(list) 0
+
+#endif
+
+//======================================================================================
+
+int Xor_list_ctor (Xor_list *list, const long capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (capacity <= 0 || capacity > Max_list_capacity)
+    {
+        Log_report ("Incorrectly entered capacity values: %ld\n", capacity);
+        Err_report ();
+
+        return XOR_LIST_CTOR_ERR;
+    }
+
+    list->data = (Xor_node*) calloc ((size_t) capacity + 1, sizeof (Xor_node));
+
+    if (Check_nullptr (list->data))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+
+        return XOR_LIST_CTOR_ERR;
+    }
+
+    list->data[Dummy_element].val  = Poison_val;
+    list->data[Dummy_element].link = Dummy_element;     //<- head ^ tail
+
+    list->capacity       = capacity;
+    list->size_data      = 0;
+    list->cnt_free_nodes = capacity;
+
+    list->head_ptr = Dummy_element;
+    list->tail_ptr = Dummy_element;
+    list->free_ptr = Identifier_free_node;
+    list->bump_ptr = 1;                         //<- Nodes are not initialized until they are used
+
+    list->is_linearized = 1;
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("EXIT\nFROM: Xor_list_ctor\n");
+        return XOR_LIST_CTOR_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+int Xor_list_dtor (Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Xor_list_dtor\n");
+        return XOR_LIST_DTOR_ERR;
+    }
+
+    free (list->data);
+    list->data = nullptr;
+
+    list->head_ptr = Poison_ptr;
+    list->tail_ptr = Poison_ptr;
+    list->free_ptr = Poison_ptr;
+    list->bump_ptr = Poison_ptr;
+
+    list->size_data      = -1;
+    list->capacity       = -1;
+    list->cnt_free_nodes = -1;
+
+    list->is_linearized = -1;
+
+    return 0;
+}
+
+//======================================================================================
+
+static link_t Xor_list_pop_free_node (Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    list->cnt_free_nodes--;
+
+    if (list->free_ptr != Identifier_free_node)
+    {
+        link_t cur_free_ptr = list->free_ptr;
+        list->free_ptr = list->data[cur_free_ptr].link;
+
+        return cur_free_ptr;
+    }
+
+    return list->bump_ptr++;
+}
+
+//======================================================================================
+
+static void Xor_list_push_free_node (Xor_list *list, const link_t ind)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    list->data[ind].val  = Poison_val;
+    list->data[ind].link = list->free_ptr;
+
+    list->free_ptr = ind;
+
+    list->cnt_free_nodes++;
+
+    return;
+}
+
+//======================================================================================
+
+static link_t Xor_list_link_node (Xor_list *list, const link_t prev_ptr, const link_t next_ptr, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (list->capacity == list->size_data + 1)
+    {
+        double new_capacity = (double) list->capacity * LIST_GROWTH_FACTOR + 1;
+
+        if (Xor_list_recalloc (list, (new_capacity < (double) Max_list_capacity) ?
+                                     (long) new_capacity : Max_list_capacity))
+        {
+            Log_report ("Recalloc error\n");
+            return XOR_LIST_INSERT_ERR;
+        }
+    }
+
+    link_t cur_ptr = Xor_list_pop_free_node (list);
+
+    list->data[cur_ptr].val  = val;
+    list->data[cur_ptr].link = prev_ptr ^ next_ptr;
+
+    //With an empty list prev_ptr and next_ptr are both Dummy_element and its link stays zero
+    list->data[prev_ptr].link ^= next_ptr ^ cur_ptr;
+    list->data[next_ptr].link ^= prev_ptr ^ cur_ptr;
+
+    if (prev_ptr == Dummy_element) list->head_ptr = cur_ptr;
+    if (next_ptr == Dummy_element) list->tail_ptr = cur_ptr;
+
+    if (list->size_data != 0 && !(next_ptr == Dummy_element && cur_ptr == prev_ptr + 1))
+        list->is_linearized = 0;
+
+    list->size_data++;
+
+    return cur_ptr;
+}
+
+//======================================================================================
+
+link_t Xor_list_insert_front (Xor_list *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Xor_list_insert_front, val = %d\n", val);
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    link_t cur_ptr = Xor_list_link_node (list, Dummy_element, list->head_ptr, val);
+
+    if (cur_ptr < 0)
+    {
+        Log_report ("Node linking error, val = %d\n", val);
+        Err_report ();
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("EXIT\nFROM: Xor_list_insert_front, val = %d\n", val);
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    return cur_ptr;
+}
+
+//======================================================================================
+
+link_t Xor_list_insert_back (Xor_list *list, const elem_t val)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Xor_list_insert_back, val = %d\n", val);
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    link_t cur_ptr = Xor_list_link_node (list, list->tail_ptr, Dummy_element, val);
+
+    if (cur_ptr < 0)
+    {
+        Log_report ("Node linking error, val = %d\n", val);
+        Err_report ();
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("EXIT\nFROM: Xor_list_insert_back, val = %d\n", val);
+        return XOR_LIST_INSERT_ERR;
+    }
+
+    return cur_ptr;
+}
+
+//======================================================================================
+
+int Xor_list_erase (Xor_list *list, Xor_cursor *cursor)
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (cursor != nullptr && "cursor is nullptr");
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Xor_list_erase, cur = %" LINK_T_SPEC "\n", cursor->cur);
+        return XOR_LIST_ERASE_ERR;
+    }
+
+    link_t prev_ptr = cursor->prev;
+    link_t cur_ptr  = cursor->cur;
+
+    if (cur_ptr <= Dummy_element || cur_ptr >= list->bump_ptr ||
+        prev_ptr < Dummy_element || prev_ptr >= list->bump_ptr)
+    {
+        Log_report ("Incorrect cursor: prev = %" LINK_T_SPEC ", cur = %" LINK_T_SPEC "\n", prev_ptr, cur_ptr);
+        return XOR_LIST_ERASE_ERR;
+    }
+
+    link_t next_ptr = list->data[cur_ptr].link ^ prev_ptr;
+
+    if (next_ptr < Dummy_element || next_ptr >= list->bump_ptr)
+    {
+        Log_report ("prev = %" LINK_T_SPEC " is not a neighbour of cur = %" LINK_T_SPEC "\n", prev_ptr, cur_ptr);
+        return XOR_LIST_ERASE_ERR;
+    }
+
+    list->data[prev_ptr].link ^= cur_ptr ^ next_ptr;
+    list->data[next_ptr].link ^= cur_ptr ^ prev_ptr;
+
+    if (prev_ptr == Dummy_element) list->head_ptr = next_ptr;
+    if (next_ptr == Dummy_element) list->tail_ptr = prev_ptr;
+
+    //Removing a node from the middle breaks the contiguous run
+    if (prev_ptr != Dummy_element && next_ptr != Dummy_element)
+        list->is_linearized = 0;
+
+    Xor_list_push_free_node (list, cur_ptr);
+
+    list->size_data--;
+
+    if (list->size_data == 0)
+        list->is_linearized = 1;
+
+    cursor->cur = next_ptr;
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("EXIT\nFROM: Xor_list_erase, cur = %" LINK_T_SPEC "\n", cur_ptr);
+        return XOR_LIST_ERASE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+static int Xor_list_recalloc (Xor_list *list, const long new_capacity)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (new_capacity <= list->capacity || new_capacity > Max_list_capacity)
+    {
+        Log_report ("The list is not subject to recalloc, new_capacity = %ld\n", new_capacity);
+        return XOR_LIST_RECALLOC_ERR;
+    }
+
+    Xor_node *new_data = (Xor_node*) realloc (list->data, ((size_t) new_capacity + 1) * sizeof (Xor_node));
+
+    if (Check_nullptr (new_data))
+    {
+        Log_report ("Memory reallocation error, new_capacity = %ld\n", new_capacity);
+        return XOR_LIST_RECALLOC_ERR;
+    }
+
+    //New nodes continue the unused region [bump_ptr, capacity]
+    list->cnt_free_nodes += new_capacity - list->capacity;
+
+    list->data     = new_data;
+    list->capacity = new_capacity;
+
+    return 0;
+}
+
+//======================================================================================
+
+int Xor_list_linearize (Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("ENTRY\nFROM: Xor_list_linearize\n");
+        return XOR_LIST_LINEARIZE_ERR;
+    }
+
+    if (list->is_linearized == 1 && (list->size_data == 0 || list->head_ptr == 1))
+        return 0;
+
+    Xor_node *new_data = (Xor_node*) calloc ((size_t) list->capacity + 1, sizeof (Xor_node));
+
+    if (Check_nullptr (new_data))
+    {
+        Log_report ("Memory allocation error\n");
+        Err_report ();
+        return XOR_LIST_LINEARIZE_ERR;
+    }
+
+    link_t size_data = (link_t) list->size_data;
+
+    Xor_cursor cursor = Xor_list_begin (list);
+
+    for (link_t counter = 1; counter <= size_data; counter++)
+    {
+        new_data[counter].val  = list->data[cursor.cur].val;
+        new_data[counter].link = (counter - 1) ^ ((counter == size_data) ? Dummy_element : counter + 1);
+
+        Xor_cursor_next (list, &cursor);
+    }
+
+    new_data[Dummy_element].val  = Poison_val;
+    new_data[Dummy_element].link = 1 ^ size_data;
+
+    free (list->data);
+    list->data = new_data;
+
+    list->head_ptr = 1;
+    list->tail_ptr = size_data;
+    list->free_ptr = Identifier_free_node;
+    list->bump_ptr = size_data + 1;
+
+    list->is_linearized = 1;
+
+    if (Check_xor_list (list))
+    {
+        REPORT ("EXIT\nFROM: Xor_list_linearize\n");
+        return XOR_LIST_LINEARIZE_ERR;
+    }
+
+    return 0;
+}
+
+//======================================================================================
+
+Xor_cursor Xor_list_begin (const Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return {Dummy_element, list->head_ptr};
+}
+
+//======================================================================================
+
+Xor_cursor Xor_list_end (const Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    return {list->tail_ptr, Dummy_element};
+}
+
+//======================================================================================
+
+void Xor_cursor_next (const Xor_list *list, Xor_cursor *cursor)
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (cursor != nullptr && "cursor is nullptr");
+
+    link_t next_ptr = list->data[cursor->cur].link ^ cursor->prev;
+
+    cursor->prev = cursor->cur;
+    cursor->cur  = next_ptr;
+
+    return;
+}
+
+//======================================================================================
+
+void Xor_cursor_prev (const Xor_list *list, Xor_cursor *cursor)
+{
+    assert (list   != nullptr && "list is nullptr");
+    assert (cursor != nullptr && "cursor is nullptr");
+
+    link_t prev_ptr = list->data[cursor->prev].link ^ cursor->cur;
+
+    cursor->cur  = cursor->prev;
+    cursor->prev = prev_ptr;
+
+    return;
+}
+
+//======================================================================================
+
+uint64_t Xor_list_verify (const Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    int check_level = List_get_check_level ();
+
+    uint64_t err = 0;
+
+    if (check_level == LIST_CHECK_OFF) return 0;
+
+    if (list->capacity  < 0)                err |= NEGATIVE_CAPAITY;
+    if (list->size_data < 0)                err |= NEGATIVE_SIZE;
+    if (list->capacity  < list->size_data)  err |= CAPACITY_LOWER_SIZE;
+
+    if (list->data == nullptr)              return err | DATA_IS_NULLPTR;
+
+    if (list->free_ptr <  Identifier_free_node  ||
+        list->free_ptr == Dummy_element         ||
+        list->free_ptr >= list->bump_ptr          ) err |= ILLIQUID_FREE_PTR;
+
+    if (list->bump_ptr <= Dummy_element         ||
+        list->bump_ptr >  list->capacity + 1      ) err |= ILLIQUID_FREE_PTR;
+
+    if (list->head_ptr < Dummy_element || list->head_ptr >= list->bump_ptr) err |= ILLIQUID_HEAD_PTR;
+    if (list->tail_ptr < Dummy_element || list->tail_ptr >= list->bump_ptr) err |= ILLIQUID_TAIL_PTR;
+
+    if (!err && list->data[Dummy_element].link != (list->head_ptr ^ list->tail_ptr))
+        err |= ILLIQUID_HEAD_PTR;
+
+    if (list->is_linearized != 0 && list->is_linearized != 1) err |= INCORRECT_LINEARIZED;
+
+    if (check_level >= LIST_CHECK_FULL && !err)
+    {
+        if (Xor_list_nodes_verifier      (list)) err |= DATA_NODE_INCORRECT;
+        if (Xor_list_free_nodes_verifier (list)) err |= DATA_FREE_NODE_INCORRECT;
+    }
+
+    return err;
+}
+
+//======================================================================================
+
+static int Xor_list_nodes_verifier (const Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    Xor_cursor cursor = Xor_list_begin (list);
+
+    for (long counter = 1; counter <= list->size_data; counter++)
+    {
+        if (cursor.cur <= Dummy_element || cursor.cur >= list->bump_ptr) return 1;
+
+        if (list->is_linearized && cursor.cur != list->head_ptr + counter - 1) return 1;
+
+        Xor_cursor_next (list, &cursor);
+    }
+
+    return cursor.cur != Dummy_element || cursor.prev != list->tail_ptr;
+}
+
+//======================================================================================
+
+static int Xor_list_free_nodes_verifier (const Xor_list *list)
+{
+    assert (list != nullptr && "list is nullptr");
+
+    long cnt_unused_nodes = list->capacity - list->bump_ptr + 1;
+
+    link_t free_ind = list->free_ptr;
+
+    for (long counter = 0; counter < list->cnt_free_nodes - cnt_unused_nodes; counter++)
+    {
+        if (free_ind <= Dummy_element || free_ind >= list->bump_ptr) return 1;
+
+        if (list->data[free_ind].val != Poison_val) return 1;
+
+        free_ind = list->data[free_ind].link;
+    }
+
+    return free_ind != Identifier_free_node;
+}
+
+//======================================================================================
+
+int Xor_list_dump_ (const Xor_list *list,
+                    const char* file_name, const char* func_name, int line, const char *format, ...)
+{
+    assert (list != nullptr && "list is nullptr\n");
+
+    uint64_t err = Xor_list_verify (list);
+
+    FILE *fp_logs = Get_log_file_ptr ();
+
+    fprintf (fp_logs, "=================================================\n\n");
+
+    va_list args;
+
+    va_start(args, format);
+    fprintf (fp_logs, "<h2>");
+    vfprintf(fp_logs, format, args);
+    fprintf (fp_logs, "</h2>");
+    va_end(args);
+
+    fprintf (fp_logs, "REFERENCE:\n");
+
+    if (err)
+        fprintf (fp_logs, "ERROR\nCaused an error in file %s, function %s, line %d\n\n", LOG_VAR);
+    else
+        fprintf (fp_logs, "OK\nlast call in file %s, function %s, line %d\n\n", LOG_VAR);
+
+    if (err)
+    {
+        fprintf (fp_logs, "ERR CODE: ");
+        Bin_represent (fp_logs, err, sizeof (err));
+        fprintf (fp_logs, "\n");
+    }
+
+    fprintf (fp_logs, "size data: %ld, capacity: %ld, cnt free nodes: %ld\n",
+                       list->size_data, list->capacity, list->cnt_free_nodes);
+
+    fprintf (fp_logs, "head: %" LINK_T_SPEC ", tail: %" LINK_T_SPEC ", free: %" LINK_T_SPEC ", bump: %" LINK_T_SPEC "\n",
+                       list->head_ptr, list->tail_ptr, list->free_ptr, list->bump_ptr);
+
+    fprintf (fp_logs, "is_linearized: %d\n\n", list->is_linearized);
+
+    if (list->data != nullptr && !(err & CAPACITY_LOWER_SIZE))
+    {
+        for (link_t it = 0; it < list->bump_ptr; it++)
+            fprintf (fp_logs, "%5" LINK_T_SPEC, it);
+        fprintf (fp_logs, "\n");
+
+        for (link_t it = 0; it < list->bump_ptr; it++)
+            fprintf (fp_logs, "%5d", list->data[it].val);
+        fprintf (fp_logs, "\n");
+
+        for (link_t it = 0; it < list->bump_ptr; it++)
+            fprintf (fp_logs, "%5" LINK_T_SPEC, list->data[it].link);
+        fprintf (fp_logs, "\n");
+    }
+
+    fprintf (fp_logs, "==========================================================\n\n");
+
+    return 0;
+}
+
+//======================================================================================
@@ -0,0 +1,106 @@
+#ifndef _XOR_LIST_H_
+#define _XOR_LIST_H_
+
+#include <stdint.h>
+
+#include "list.h"
+
+//Memory-lean list: each node keeps one link prev ^ next instead of two.
+//A node is reached only together with one of its neighbours, so the list
+//is walked by cursors (prev, cur). Dummy_element links the tail and the head.
+
+struct Xor_node
+{
+    elem_t val  = 0;
+    link_t link = 0;        //<- prev ^ next, free nodes keep the next free node
+};
+
+struct Xor_list
+{
+    long capacity       = 0;
+    long size_data      = 0;
+    long cnt_free_nodes = 0;
+
+    Xor_node *data = nullptr;
+
+    link_t head_ptr = 0;
+    link_t tail_ptr = 0;
+    link_t free_ptr = 0;    //<- Top of the stack of recycled nodes
+    link_t bump_ptr = 0;    //<- Nodes in [bump_ptr, capacity] have not been used since Xor_list_ctor
+
+    int is_linearized = 0;
+};
+
+struct Xor_cursor
+{
+    link_t prev = Dummy_element;
+    link_t cur  = Dummy_element;    //<- Dummy_element is the end of the list
+};
+
+
+enum Xor_list_func_err
+{
+    XOR_LIST_CTOR_ERR       = -1,
+    XOR_LIST_DTOR_ERR       = -2,
+
+    XOR_LIST_INSERT_ERR     = -3,
+    XOR_LIST_ERASE_ERR      = -4,
+
+    XOR_LIST_RECALLOC_ERR   = -5,
+
+    XOR_LIST_LINEARIZE_ERR  = -6,
+};
+
+
+int Xor_list_ctor (Xor_list *list, const long capacity);
+
+int Xor_list_dtor (Xor_list *list);
+
+
+/**
+ * @brief Adds a node to the front of the list
+ * @version 1.0.0
+ * @param [in] *list Structure Xor_list pointer
+ * @param [in] val The value of the added node
+ * @return Returns the physical pointer of the added node, otherwise a negative number
+*/
+link_t Xor_list_insert_front (Xor_list *list, const elem_t val);
+
+link_t Xor_list_insert_back  (Xor_list *list, const elem_t val);
+
+/**
+ * @brief Removes the node of the cursor
+ * @version 1.0.0
+ * @param [in] *list Structure Xor_list pointer
+ * @param [in] *cursor Cursor of the removed node, after the call it points to the next node
+ * @return Returns zero if the node is deleted, otherwise returns a non-zero number
+*/
+int Xor_list_erase (Xor_list *list, Xor_cursor *cursor);
+
+/**
+ * @brief Puts the nodes in logical order to the physical indexes 1..size_data
+ * @version 1.0.0
+ * @param [in] *list Structure Xor_list pointer
+ * @return Returns zero if the list is linearized, otherwise returns a non-zero number
+ * @note Cursors taken before the call are invalid after it
+*/
+int Xor_list_linearize (Xor_list *list);
+
+
+Xor_cursor Xor_list_begin (const Xor_list *list);       //<- Cursor of the head
+
+Xor_cursor Xor_list_end   (const Xor_list *list);       //<- Cursor after the tail, Xor_cursor_prev from it gives the tail
+
+void Xor_cursor_next (const Xor_list *list, Xor_cursor *cursor);
+
+void Xor_cursor_prev (const Xor_list *list, Xor_cursor *cursor);
+
+
+uint64_t Xor_list_verify (const Xor_list *list);
+
+#define Xor_list_dump(list, ...)                       \
+        Xor_list_dump_ (list, LOG_ARGS, __VA_ARGS__)
+
+int Xor_list_dump_ (const Xor_list *list, LOG_PARAMETS, const char *format, ...);
+
+#endif  //#endif _XOR_LIST_H_